@@ -0,0 +1,712 @@
+// Benchmarks of the npsr kernels
+//
+// Built for the best target of the host through static dispatch, see
+// CMakeLists.txt, and run as
+//
+//   npsr_bench [section...]
+//
+// which runs every section whose name contains one of the arguments, or all
+// of them. Numbers are ticks of hwy::timer per element unless stated
+// otherwise, see harness.h.
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "bench/harness.h"
+#include "hwy/highway.h"
+#include "npsr/npsr.h"
+
+#if NPSR_BENCH_LIBMVEC
+#include <immintrin.h>
+
+// glibc's vector exp, see CMakeLists.txt; the AVX2 variants when compiled
+// for them, the SSE2 ones otherwise
+extern "C" {
+#ifdef __AVX2__
+__m256d _ZGVdN4v_exp(__m256d);
+__m256 _ZGVdN8v_expf(__m256);
+#else
+__m128d _ZGVbN2v_exp(__m128d);
+__m128 _ZGVbN4v_expf(__m128);
+#endif
+}
+#endif
+
+namespace npsr::bench {
+namespace {
+
+namespace hn = hwy::HWY_NAMESPACE;
+using namespace npsr::HWY_NAMESPACE;
+
+// 16K elements, the arrays of a row stay within L2
+constexpr size_t kCount = 1 << 14;
+
+template <size_t K>
+using Way = std::integral_constant<size_t, K>;
+
+template <typename T>
+const char *TypeName() {
+  return std::is_same_v<T, float> ? "float" : "double";
+}
+
+// Prints one row per call of `fn` with 1, 2 and 4 vectors per iteration
+template <typename F>
+void InterleaveRow(const char *label, const F &fn) {
+  PrintRow(label, {TicksPerElement(kCount, [&] { fn(Way<1>()); }),
+                   TicksPerElement(kCount, [&] { fn(Way<2>()); }),
+                   TicksPerElement(kCount, [&] { fn(Way<4>()); })});
+}
+
+// Applies the vector function `fn` over `in`, whose size is a multiple of
+// the lanes
+template <typename T, typename F>
+void Map(const std::vector<T> &in, std::vector<T> &out, const F &fn) {
+  const hn::ScalableTag<T> d;
+  const size_t N = hn::Lanes(d);
+  for (size_t i = 0; i + N <= in.size(); i += N) {
+    hn::StoreU(fn(hn::LoadU(d, in.data() + i)), d, out.data() + i);
+  }
+  Sink(out.data());
+}
+
+// Applies the scalar function `fn` over `in`, the libm reference rows
+template <typename T, typename F>
+void MapScalar(const std::vector<T> &in, std::vector<T> &out, const F &fn) {
+  for (size_t i = 0; i < in.size(); ++i) {
+    out[i] = fn(in[i]);
+  }
+  Sink(out.data());
+}
+
+/**
+ * Interleaving of the trig array kernels: kInterleave = 1, 2 and 4 over the
+ * same data, |x| < 100, so only the standard range kernels run.
+ */
+template <typename T>
+void Interleave() {
+  const std::vector<T> in = Uniform<T>(-100, 100, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("interleave, %s: %25s %9s %9s\n", TypeName<T>(), "1-way",
+              "2-way", "4-way");
+  InterleaveRow("Sin", [&](auto k) {
+    Sin<decltype(k)::value>(high, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  InterleaveRow("Cos", [&](auto k) {
+    Cos<decltype(k)::value>(high, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  InterleaveRow("Tan", [&](auto k) {
+    Tan<decltype(k)::value>(high, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  InterleaveRow("Sin kLowAccuracy", [&](auto k) {
+    Sin<decltype(k)::value>(low, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  InterleaveRow("Cos kLowAccuracy", [&](auto k) {
+    Cos<decltype(k)::value>(low, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  InterleaveRow("Tan kLowAccuracy", [&](auto k) {
+    Tan<decltype(k)::value>(low, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+}
+
+/**
+ * Rungs of the kMaxULP<N> ladder, see LowDegree(): each N selects a shorter
+ * Low<> polynomial, next to kLowAccuracy and the default High<> tier. Float
+ * has no rung past kMaxULP<4096>, so its last two columns repeat it.
+ */
+template <typename T>
+void Ladder() {
+  const std::vector<T> in = Uniform<T>(-100, 100, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  Precise ulp32{kMaxULP<32>, kNoExceptions};
+  Precise ulp4096{kMaxULP<4096>, kNoExceptions};
+  Precise ulp2e20{kMaxULP<(1 << 20)>, kNoExceptions};
+  Precise ulp2e27{kMaxULP<(1 << 27)>, kNoExceptions};
+  std::printf("ladder, %s: %30s %9s %9s %9s %9s %9s\n", TypeName<T>(),
+              "default", "low", "<32>", "<4096>", "<2^20>", "<2^27>");
+  auto row = [&](const char *label, const auto &fn) {
+    auto ticks = [&](auto &prec) {
+      return TicksPerElement(kCount, [&] {
+        fn(prec, in.data(), out.data());
+        Sink(out.data());
+      });
+    };
+    PrintRow(label, {ticks(high), ticks(low), ticks(ulp32), ticks(ulp4096),
+                     ticks(ulp2e20), ticks(ulp2e27)});
+  };
+  row("Sin", [](auto &prec, auto *x, auto *y) { Sin(prec, x, kCount, y); });
+  row("Cos", [](auto &prec, auto *x, auto *y) { Cos(prec, x, kCount, y); });
+}
+
+/**
+ * kSmallArgument: the gain where every vector is within |x| ≤ π/4, and the
+ * cost of its AllTrue check where none or only some are. "sparse" has one
+ * element in 16 outside, so about half the float vectors and a quarter of
+ * the double ones take the branch at random.
+ */
+template <typename T>
+void SmallArgument() {
+  const T kQuarterPi = static_cast<T>(0.7853981633974483);
+  const std::vector<T> small = Uniform<T>(-kQuarterPi, kQuarterPi, kCount);
+  const std::vector<T> wide = Uniform<T>(-100, 100, kCount);
+  std::vector<T> sparse = small;
+  std::mt19937 rng(2);
+  for (size_t i = 0; i < kCount; i += 16) {
+    sparse[i + rng() % 16] = wide[i];
+  }
+  std::vector<T> out(kCount);
+  Precise def{kNoExceptions};
+  Precise fast{kSmallArgument, kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  Precise low_fast{kLowAccuracy, kSmallArgument, kNoExceptions};
+  std::printf("small argument, %s: %21s %9s %9s %9s\n", TypeName<T>(),
+              "default", "kSmallArg", "low", "low+kSmall");
+  auto row = [&](const char *label, const std::vector<T> &in) {
+    auto ticks = [&](auto &prec) {
+      return TicksPerElement(
+          kCount, [&] { Map(in, out, [&](auto x) { return Sin(prec, x); }); });
+    };
+    PrintRow(label, {ticks(def), ticks(fast), ticks(low), ticks(low_fast)});
+  };
+  row("Sin |x| <= pi/4", small);
+  row("Sin sparse", sparse);
+  row("Sin |x| < 100", wide);
+}
+
+// Truncated series of e^-x, highest degree first as Poly<> expects; maps
+// [0, 1] into itself, so it can be iterated
+template <typename T, size_t N>
+struct ExpNegSeries {
+  T c[N] = {};
+  constexpr ExpNegSeries() {
+    T term = 1;
+    for (size_t k = 0; k < N; ++k) {
+      c[N - 1 - k] = term;
+      term = -term / static_cast<T>(k + 1);
+    }
+  }
+};
+
+template <PolyScheme kScheme, typename T, size_t N>
+void PolyRow(const char *label, const std::vector<T> &in,
+             std::vector<T> &out) {
+  static constexpr ExpNegSeries<T, N> kSeries;
+  const hn::ScalableTag<T> d;
+  constexpr size_t kSteps = 1024;
+  // One dependent chain: ticks per call, all of its latency exposed
+  const double latency = TicksPerElement(kSteps, [&] {
+    auto v = hn::Set(d, static_cast<T>(0.5));
+    for (size_t i = 0; i < kSteps; ++i) {
+      v = Poly<kScheme>(v, kSeries.c);
+    }
+    Sink(hn::GetLane(v));
+  });
+  // Independent vectors: ticks per element, bound by the issue width
+  const double throughput = TicksPerElement(kCount, [&] {
+    Map(in, out, [&](auto x) { return Poly<kScheme>(x, kSeries.c); });
+  });
+  PrintRow(label, {latency, throughput});
+}
+
+/**
+ * Polynomial schemes of Poly<>, latency-bound (one dependent chain) and
+ * throughput-bound (a whole array), for the degrees of the kernels.
+ */
+template <typename T>
+void PolySchemes() {
+  const std::vector<T> in = Uniform<T>(0, 1, kCount);
+  std::vector<T> out(kCount);
+  std::printf("poly, %s: %31s %9s\n", TypeName<T>(), "latency", "per elem");
+  PolyRow<PolyScheme::kHorner, T, 8>("degree 7 kHorner", in, out);
+  PolyRow<PolyScheme::kEstrin, T, 8>("degree 7 kEstrin", in, out);
+  PolyRow<PolyScheme::kSplit, T, 8>("degree 7 kSplit", in, out);
+  PolyRow<PolyScheme::kHorner, T, 13>("degree 12 kHorner", in, out);
+  PolyRow<PolyScheme::kEstrin, T, 13>("degree 12 kEstrin", in, out);
+  PolyRow<PolyScheme::kSplit, T, 13>("degree 12 kSplit", in, out);
+  PolyRow<PolyScheme::kHorner, T, 20>("degree 19 kHorner", in, out);
+  PolyRow<PolyScheme::kEstrin, T, 20>("degree 19 kEstrin", in, out);
+  PolyRow<PolyScheme::kSplit, T, 20>("degree 19 kSplit", in, out);
+}
+
+// Tan against the quotient of Sin and Cos at the same accuracy
+template <typename T>
+void TanVsSinCos() {
+  const std::vector<T> in = Uniform<T>(-100, 100, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("tan, %s: %32s %9s\n", TypeName<T>(), "default",
+              "low");
+  auto tan = [&](auto &prec) {
+    return TicksPerElement(kCount, [&] {
+      Map(in, out, [&](auto x) { return Tan(prec, x); });
+    });
+  };
+  auto quotient = [&](auto &prec) {
+    return TicksPerElement(kCount, [&] {
+      Map(in, out,
+          [&](auto x) { return hn::Div(Sin(prec, x), Cos(prec, x)); });
+    });
+  };
+  PrintRow("Tan", {tan(high), tan(low)});
+  PrintRow("Sin / Cos", {quotient(high), quotient(low)});
+  PrintRow("std::tan",
+           {TicksPerElement(kCount, [&] {
+             MapScalar(in, out, [](T x) { return std::tan(x); });
+           })});
+}
+
+#if NPSR_BENCH_LIBMVEC
+template <typename T>
+void LibmvecExp(const std::vector<T> &in, std::vector<T> &out) {
+  for (size_t i = 0; i < in.size();) {
+#ifdef __AVX2__
+    if constexpr (std::is_same_v<T, float>) {
+      _mm256_storeu_ps(out.data() + i,
+                       _ZGVdN8v_expf(_mm256_loadu_ps(in.data() + i)));
+      i += 8;
+    } else {
+      _mm256_storeu_pd(out.data() + i,
+                       _ZGVdN4v_exp(_mm256_loadu_pd(in.data() + i)));
+      i += 4;
+    }
+#else
+    if constexpr (std::is_same_v<T, float>) {
+      _mm_storeu_ps(out.data() + i, _ZGVbN4v_expf(_mm_loadu_ps(in.data() + i)));
+      i += 4;
+    } else {
+      _mm_storeu_pd(out.data() + i, _ZGVbN2v_exp(_mm_loadu_pd(in.data() + i)));
+      i += 2;
+    }
+#endif
+  }
+  Sink(out.data());
+}
+#endif
+
+// The exponentials against scalar libm and, on x86 glibc, libmvec's exp
+template <typename T>
+void Exponential() {
+  const std::vector<T> in = Uniform<T>(-80, 80, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("exp, %s: %32s %9s %9s\n", TypeName<T>(), "default", "low",
+              "libm");
+  auto row = [&](const char *label, auto fn, T (*libm)(T)) {
+    PrintRow(label,
+             {TicksPerElement(kCount, [&] { fn(high, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { fn(low, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { MapScalar(in, out, libm); })});
+  };
+  row("Exp", [](auto &prec, auto *x, auto *y) { Exp(prec, x, kCount, y); },
+      [](T x) { return std::exp(x); });
+  row("Exp2", [](auto &prec, auto *x, auto *y) { Exp2(prec, x, kCount, y); },
+      [](T x) { return std::exp2(x); });
+  row("Exp10", [](auto &prec, auto *x, auto *y) { Exp10(prec, x, kCount, y); },
+      [](T x) { return std::pow(static_cast<T>(10), x); });
+  row("Expm1", [](auto &prec, auto *x, auto *y) { Expm1(prec, x, kCount, y); },
+      [](T x) { return std::expm1(x); });
+#if NPSR_BENCH_LIBMVEC
+  PrintRow("libmvec exp",
+           {TicksPerElement(kCount, [&] { LibmvecExp(in, out); })});
+#endif
+}
+
+// The inverse trigonometric functions against scalar libm. Arg reads
+// kCount interleaved (x, y) pairs, so every row is per output element.
+template <typename T>
+void InvTrig() {
+  const std::vector<T> unit = Uniform<T>(-1, 1, kCount);
+  const std::vector<T> ys = Uniform<T>(-100, 100, kCount, 2);
+  const std::vector<T> xs = Uniform<T>(-100, 100, kCount, 3);
+  const std::vector<T> pairs = Uniform<T>(-100, 100, 2 * kCount, 4);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("invtrig, %s: %28s %9s %9s\n", TypeName<T>(), "default", "low",
+              "libm");
+  auto row = [&](const char *label, const std::vector<T> &in, auto fn,
+                 T (*libm)(T)) {
+    PrintRow(label,
+             {TicksPerElement(kCount, [&] { fn(high, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { fn(low, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { MapScalar(in, out, libm); })});
+  };
+  row("Asin", unit,
+      [](auto &prec, auto *x, auto *y) { Asin(prec, x, kCount, y); },
+      [](T x) { return std::asin(x); });
+  row("Acos", unit,
+      [](auto &prec, auto *x, auto *y) { Acos(prec, x, kCount, y); },
+      [](T x) { return std::acos(x); });
+  row("Atan", ys,
+      [](auto &prec, auto *x, auto *y) { Atan(prec, x, kCount, y); },
+      [](T x) { return std::atan(x); });
+  PrintRow("Atan2",
+           {TicksPerElement(kCount,
+                            [&] {
+                              Atan2(high, ys.data(), xs.data(), kCount,
+                                    out.data());
+                            }),
+            TicksPerElement(kCount,
+                            [&] {
+                              Atan2(low, ys.data(), xs.data(), kCount,
+                                    out.data());
+                            }),
+            TicksPerElement(kCount, [&] {
+              for (size_t i = 0; i < kCount; ++i) {
+                out[i] = std::atan2(ys[i], xs[i]);
+              }
+              Sink(out.data());
+            })});
+  PrintRow("Arg",
+           {TicksPerElement(
+                kCount, [&] { Arg(high, pairs.data(), kCount, out.data()); }),
+            TicksPerElement(
+                kCount, [&] { Arg(low, pairs.data(), kCount, out.data()); }),
+            TicksPerElement(kCount, [&] {
+              for (size_t i = 0; i < kCount; ++i) {
+                out[i] = std::atan2(pairs[2 * i + 1], pairs[2 * i]);
+              }
+              Sink(out.data());
+            })});
+}
+
+// Asinh, Acosh and Atanh against scalar libm, each over its domain
+template <typename T>
+void InvHyperbolic() {
+  const std::vector<T> wide = Uniform<T>(-100, 100, kCount);
+  const std::vector<T> above_one = Uniform<T>(1, 100, kCount);
+  const std::vector<T> unit = Uniform<T>(-1, 1, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("invhyperbolic, %s: %22s %9s %9s\n", TypeName<T>(), "default",
+              "low", "libm");
+  auto row = [&](const char *label, const std::vector<T> &in, auto fn,
+                 T (*libm)(T)) {
+    PrintRow(label,
+             {TicksPerElement(kCount, [&] { fn(high, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { fn(low, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { MapScalar(in, out, libm); })});
+  };
+  row("Asinh", wide,
+      [](auto &prec, auto *x, auto *y) { Asinh(prec, x, kCount, y); },
+      [](T x) { return std::asinh(x); });
+  row("Acosh", above_one,
+      [](auto &prec, auto *x, auto *y) { Acosh(prec, x, kCount, y); },
+      [](T x) { return std::acosh(x); });
+  row("Atanh", unit,
+      [](auto &prec, auto *x, auto *y) { Atanh(prec, x, kCount, y); },
+      [](T x) { return std::atanh(x); });
+}
+
+/**
+ * Standard normal deviates from the same kCount uniforms, three ways:
+ * NormQuantile, √2·ErfInv(2u - 1), and Box-Muller, where the first half of
+ * the uniforms gives the radii √(-2·log u) and the second half the angles
+ * 2π·u, whose SinCos over a ReductionPlan yields two deviates per pair.
+ * The plan is built in every call, as a generator would.
+ */
+template <typename T>
+void Normal() {
+  const hn::ScalableTag<T> d;
+  const size_t N = hn::Lanes(d);
+  constexpr size_t kHalf = kCount / 2;
+  // Away from 0, where Log and NormQuantile diverge
+  const std::vector<T> u = Uniform<T>(0x1p-20, 1, kCount);
+  std::vector<T> out(kCount), radius(kHalf), angle(kHalf), sines(kHalf),
+      cosines(kHalf);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("normal, %s: %29s %9s\n", TypeName<T>(), "default", "low");
+  auto quantile = [&](auto &prec) {
+    return TicksPerElement(
+        kCount, [&] { NormQuantile(prec, u.data(), kCount, out.data()); });
+  };
+  auto erf_inverse = [&](auto &prec) {
+    return TicksPerElement(kCount, [&] {
+      Map(u, out, [&](auto x) {
+        const auto one = hn::Set(d, static_cast<T>(1.0));
+        const auto sqrt2 = hn::Set(d, static_cast<T>(1.4142135623730951));
+        return hn::Mul(sqrt2, ErfInv(prec, hn::Sub(hn::Add(x, x), one)));
+      });
+    });
+  };
+  auto box_muller = [&](auto &prec) {
+    return TicksPerElement(kCount, [&] {
+      Log(prec, u.data(), kHalf, radius.data());
+      const auto minus_two = hn::Set(d, static_cast<T>(-2.0));
+      const auto two_pi = hn::Set(d, static_cast<T>(6.283185307179586));
+      for (size_t i = 0; i < kHalf; i += N) {
+        const auto l = hn::LoadU(d, radius.data() + i);
+        hn::StoreU(hn::Sqrt(hn::Mul(minus_two, l)), d, radius.data() + i);
+        const auto v = hn::LoadU(d, u.data() + kHalf + i);
+        hn::StoreU(hn::Mul(two_pi, v), d, angle.data() + i);
+      }
+      const ReductionPlan<T> plan(prec, angle.data(), kHalf);
+      SinCos(prec, plan, sines.data(), cosines.data());
+      for (size_t i = 0; i < kHalf; i += N) {
+        const auto r = hn::LoadU(d, radius.data() + i);
+        hn::StoreU(hn::Mul(r, hn::LoadU(d, cosines.data() + i)), d,
+                   out.data() + i);
+        hn::StoreU(hn::Mul(r, hn::LoadU(d, sines.data() + i)), d,
+                   out.data() + kHalf + i);
+      }
+      Sink(out.data());
+    });
+  };
+  PrintRow("NormQuantile", {quantile(high), quantile(low)});
+  PrintRow("sqrt2 * ErfInv(2u - 1)", {erf_inverse(high), erf_inverse(low)});
+  PrintRow("Box-Muller Log, Sqrt, SinCos",
+           {box_muller(high), box_muller(low)});
+}
+
+// LGamma and TGamma against scalar libm, with and without the negative
+// arguments that take the reflection path
+template <typename T>
+void Gamma() {
+  const std::vector<T> positive = Uniform<T>(0, 20, kCount);
+  const std::vector<T> mixed = Uniform<T>(-20, 20, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("gamma, %s: %30s %9s %9s\n", TypeName<T>(), "default", "low",
+              "libm");
+  auto row = [&](const char *label, const std::vector<T> &in, auto fn,
+                 T (*libm)(T)) {
+    PrintRow(label,
+             {TicksPerElement(kCount, [&] { fn(high, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { fn(low, in.data(), out.data()); }),
+              TicksPerElement(kCount, [&] { MapScalar(in, out, libm); })});
+  };
+  auto log_gamma = [](auto &prec, auto *x, auto *y) {
+    LGamma(prec, x, kCount, y);
+  };
+  auto true_gamma = [](auto &prec, auto *x, auto *y) {
+    TGamma(prec, x, kCount, y);
+  };
+  auto std_lgamma = [](T x) { return std::lgamma(x); };
+  auto std_tgamma = [](T x) { return std::tgamma(x); };
+  row("LGamma (0, 20)", positive, log_gamma, std_lgamma);
+  row("LGamma (-20, 20)", mixed, log_gamma, std_lgamma);
+  row("TGamma (0, 20)", positive, true_gamma, std_tgamma);
+  row("TGamma (-20, 20)", mixed, true_gamma, std_tgamma);
+}
+
+// Expit and Logit against their scalar formulas
+template <typename T>
+void Logistic() {
+  const std::vector<T> x = Uniform<T>(-20, 20, kCount);
+  const std::vector<T> p = Uniform<T>(0, 1, kCount);
+  std::vector<T> out(kCount);
+  Precise high{kNoExceptions};
+  Precise low{kLowAccuracy, kNoExceptions};
+  std::printf("logistic, %s: %27s %9s %9s\n", TypeName<T>(), "default",
+              "low", "libm");
+  PrintRow("Expit",
+           {TicksPerElement(kCount,
+                            [&] { Expit(high, x.data(), kCount, out.data()); }),
+            TicksPerElement(kCount,
+                            [&] { Expit(low, x.data(), kCount, out.data()); }),
+            TicksPerElement(kCount, [&] {
+              MapScalar(x, out, [](T v) { return 1 / (1 + std::exp(-v)); });
+            })});
+  PrintRow("Logit",
+           {TicksPerElement(kCount,
+                            [&] { Logit(high, p.data(), kCount, out.data()); }),
+            TicksPerElement(kCount,
+                            [&] { Logit(low, p.data(), kCount, out.data()); }),
+            TicksPerElement(kCount, [&] {
+              MapScalar(p, out, [](T v) { return std::log(v / (1 - v)); });
+            })});
+}
+
+/**
+ * ReductionPlan: one evaluation over the plan against recomputing from the
+ * angles, and the cost of building the plan, for standard range angles and
+ * for angles past the extended reduction threshold.
+ */
+template <typename T>
+void Plan() {
+  std::vector<T> out(kCount), out2(kCount);
+  Precise prec{kNoExceptions};
+  std::printf("plan, %s: %31s %9s\n", TypeName<T>(), "|x|<100",
+              "|x|<1e6");
+  const std::vector<T> std_in = Uniform<T>(-100, 100, kCount);
+  const std::vector<T> large_in = Uniform<T>(-1e6, 1e6, kCount);
+  const ReductionPlan<T> std_plan(prec, std_in.data(), kCount);
+  const ReductionPlan<T> large_plan(prec, large_in.data(), kCount);
+  auto row = [&](const char *label, const auto &fn) {
+    PrintRow(label, {TicksPerElement(kCount, [&] { fn(std_in, std_plan); }),
+                     TicksPerElement(kCount,
+                                     [&] { fn(large_in, large_plan); })});
+  };
+  row("build plan", [&](const auto &in, const auto &) {
+    ReductionPlan<T> plan(prec, in.data(), kCount);
+    Sink(plan.RHi());
+  });
+  row("Sin", [&](const auto &in, const auto &) {
+    Sin(prec, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  row("Sin over plan", [&](const auto &, const auto &plan) {
+    Sin(prec, plan, out.data());
+    Sink(out.data());
+  });
+  row("Sin + Cos", [&](const auto &in, const auto &) {
+    Sin(prec, in.data(), kCount, out.data());
+    Cos(prec, in.data(), kCount, out2.data());
+    Sink(out.data());
+    Sink(out2.data());
+  });
+  row("SinCos over plan", [&](const auto &, const auto &plan) {
+    SinCos(prec, plan, out.data(), out2.data());
+    Sink(out.data());
+    Sink(out2.data());
+  });
+  row("Tan", [&](const auto &in, const auto &) {
+    Tan(prec, in.data(), kCount, out.data());
+    Sink(out.data());
+  });
+  row("Tan over plan", [&](const auto &, const auto &plan) {
+    Tan(prec, plan, out.data());
+    Sink(out.data());
+  });
+}
+
+/**
+ * LargeArgument policies: ticks per vector call of the vector Sin and Tan,
+ * at the 50th, 99th and 99.9th percentile. One element in 64 is large, up to
+ * 10^13 to stay within the range of kNeverExtended, at a random position,
+ * so the default kBranchy mispredicts on the vectors holding one and pays
+ * the extended path there. kNoLargeArgument gets those lanes wrong, it is
+ * the floor.
+ */
+template <typename T>
+void TailLatency() {
+  const hn::ScalableTag<T> d;
+  const size_t N = hn::Lanes(d);
+  std::vector<T> in = Uniform<T>(-100, 100, kCount);
+  const std::vector<T> large = Uniform<T>(-1e13, 1e13, kCount / 64, 3);
+  std::mt19937 rng(4);
+  for (size_t i = 0; i < kCount; i += 64) {
+    in[i + rng() % 64] = large[i / 64];
+  }
+  std::vector<T> out(kCount);
+  Precise branchy{kNoExceptions};
+  Precise branchless{LargeArgument::kBranchless, kNoExceptions};
+  Precise never{LargeArgument::kNeverExtended, kNoExceptions};
+  Precise none{kNoLargeArgument, kNoExceptions};
+  std::printf("tail, %s, ticks per vector: %15s %9s %9s\n", TypeName<T>(),
+              "p50", "p99", "p99.9");
+  auto row = [&](const char *label, auto &prec, const auto &fn) {
+    std::vector<double> samples = TicksPerCall(kCount / N, [&](size_t i) {
+      hn::StoreU(fn(prec, hn::LoadU(d, in.data() + i * N)), d,
+                 out.data() + i * N);
+      Sink(out.data());
+    });
+    PrintRow(label, {Quantile(samples, 0.5), Quantile(samples, 0.99),
+                     Quantile(samples, 0.999)});
+  };
+  auto sin = [](auto &prec, auto x) { return Sin(prec, x); };
+  auto tan = [](auto &prec, auto x) { return Tan(prec, x); };
+  row("Sin kBranchy", branchy, sin);
+  row("Sin kBranchless", branchless, sin);
+  row("Sin kNeverExtended", never, sin);
+  row("Sin kNoLargeArgument", none, sin);
+  row("Tan kBranchy", branchy, tan);
+  row("Tan kBranchless", branchless, tan);
+  row("Tan kNeverExtended", never, tan);
+  row("Tan kNoLargeArgument", none, tan);
+}
+
+struct Section {
+  const char *name;
+  void (*run)();
+};
+
+constexpr Section kSections[] = {
+    {"interleave", [] {
+       Interleave<float>();
+       Interleave<double>();
+     }},
+    {"ladder", [] {
+       Ladder<float>();
+       Ladder<double>();
+     }},
+    {"small", [] {
+       SmallArgument<float>();
+       SmallArgument<double>();
+     }},
+    {"poly", [] {
+       PolySchemes<float>();
+       PolySchemes<double>();
+     }},
+    {"tan", [] {
+       TanVsSinCos<float>();
+       TanVsSinCos<double>();
+     }},
+    {"plan", [] {
+       Plan<float>();
+       Plan<double>();
+     }},
+    {"exp", [] {
+       Exponential<float>();
+       Exponential<double>();
+     }},
+    {"invtrig", [] {
+       InvTrig<float>();
+       InvTrig<double>();
+     }},
+    {"invhyperbolic", [] {
+       InvHyperbolic<float>();
+       InvHyperbolic<double>();
+     }},
+    {"normal", [] {
+       Normal<float>();
+       Normal<double>();
+     }},
+    {"gamma", [] {
+       Gamma<float>();
+       Gamma<double>();
+     }},
+    {"logistic", [] {
+       Logistic<float>();
+       Logistic<double>();
+     }},
+    {"tail", [] {
+       TailLatency<float>();
+       TailLatency<double>();
+     }},
+};
+
+}  // namespace
+}  // namespace npsr::bench
+
+int main(int argc, char **argv) {
+  using npsr::bench::kSections;
+  std::printf("target: %s\n", hwy::TargetName(HWY_TARGET));
+  for (const auto &section : kSections) {
+    bool selected = argc < 2;
+    for (int i = 1; i < argc; ++i) {
+      selected |= std::strstr(section.name, argv[i]) != nullptr;
+    }
+    if (selected) {
+      section.run();
+    }
+  }
+  return 0;
+}
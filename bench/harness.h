@@ -0,0 +1,109 @@
+// Minimal timing harness shared by the benchmarks of bench.cc
+//
+// Timings are taken with hwy::timer, whose ticks come from the invariant
+// time-stamp counter on x86 and the virtual counter on Arm. They match core
+// cycles only while the core runs at its nominal frequency, so pin the
+// frequency (or disable turbo) before comparing numbers across runs.
+
+#ifndef NPSR_BENCH_HARNESS_H_
+#define NPSR_BENCH_HARNESS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+#include "hwy/timer.h"
+
+namespace npsr::bench {
+
+// Makes `value`, and any memory it points to, observable so the benchmarked
+// work is not optimized away; a compiler barrier only, no fence
+template <typename T>
+inline void Sink(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile T sink;
+  sink = value;
+#endif
+}
+
+// Value of the sorted `samples` at quantile q ∈ [0, 1]
+inline double Quantile(std::vector<double> &samples, double q) {
+  const size_t k = std::min(samples.size() - 1,
+                            static_cast<size_t>(q * samples.size()));
+  std::nth_element(samples.begin(), samples.begin() + k, samples.end());
+  return samples[k];
+}
+
+/**
+ * Median ticks per element of `fn`, one call processing `count` elements,
+ * over `reps` timed calls after one warm-up call.
+ */
+template <typename F>
+inline double TicksPerElement(size_t count, const F &fn, size_t reps = 31) {
+  std::vector<double> samples(reps);
+  fn();
+  for (double &sample : samples) {
+    const uint64_t t0 = hwy::timer::Start();
+    fn();
+    const uint64_t t1 = hwy::timer::Stop();
+    sample = static_cast<double>(t1 - t0) / static_cast<double>(count);
+  }
+  return Quantile(samples, 0.5);
+}
+
+/**
+ * Ticks of each call fn(i), i ∈ [0, count), over `passes` passes after one
+ * warm-up pass, the samples of the tail latency rows. Every call is timed
+ * on its own, so each sample includes the fences of hwy::timer, a few tens
+ * of ticks; compare samples with each other rather than with
+ * TicksPerElement.
+ */
+template <typename F>
+inline std::vector<double> TicksPerCall(size_t count, const F &fn,
+                                        size_t passes = 8) {
+  std::vector<double> samples;
+  samples.reserve(count * passes);
+  for (size_t i = 0; i < count; ++i) {
+    fn(i);
+  }
+  for (size_t pass = 0; pass < passes; ++pass) {
+    for (size_t i = 0; i < count; ++i) {
+      const uint64_t t0 = hwy::timer::Start();
+      fn(i);
+      const uint64_t t1 = hwy::timer::Stop();
+      samples.push_back(static_cast<double>(t1 - t0));
+    }
+  }
+  return samples;
+}
+
+template <typename T>
+inline std::vector<T> Uniform(double lo, double hi, size_t count,
+                              unsigned seed = 1) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> dist(lo, hi);
+  std::vector<T> ret(count);
+  for (T &x : ret) {
+    x = static_cast<T>(dist(rng));
+  }
+  return ret;
+}
+
+// Row of the printed tables: a label followed by one number per column
+inline void PrintRow(const char *label, std::initializer_list<double> cols) {
+  std::printf("  %-34s", label);
+  for (double col : cols) {
+    std::printf(" %9.2f", col);
+  }
+  std::printf("\n");
+}
+
+}  // namespace npsr::bench
+
+#endif  // NPSR_BENCH_HARNESS_H_
@@ -0,0 +1,75 @@
+#if defined(NPSR_DW_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_DW_INL_H_
+#undef NPSR_DW_INL_H_
+#else
+#define NPSR_DW_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE {
+
+// Double-word arithmetic, a value carried as hi + lo with |lo| within half
+// an ULP of hi. Where one operand is known to dominate, kernels spell out the
+// cheaper fast two-sum inline instead, next to the reason it is exact.
+
+/// a + b as a double-word hi + lo for any order of magnitude, Knuth's two-sum
+template <typename V>
+NPSR_INTRIN V TwoSum(V a, V b, V &lo) {
+  using namespace hn;
+  V s = Add(a, b);
+  V b_virt = Sub(s, a);
+  lo = Add(Sub(a, Sub(s, b_virt)), Sub(b, b_virt));
+  return s;
+}
+
+/**
+ * This function computes a·b as a double-word hi + lo, exact by FMA. Without
+ * native FMA both operands are split by masking half of their digits, which
+ * unlike Veltkamp's splitting can't overflow, and only the product of the
+ * low halves may round, far below lo.
+ */
+template <typename V>
+NPSR_INTRIN V TwoProd(V a, V b, V &lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using TI = hwy::MakeSigned<T>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+
+  V hi = Mul(a, b);
+  if constexpr (kNativeFMA) {
+    lo = MulSub(a, b, hi);
+  } else {
+    constexpr int kHalf = (hwy::MantissaBits<T>() + 2) / 2;
+    const V mask = BitCast(d, Set(di, -(TI{1} << kHalf)));
+    V a_hi = And(a, mask);
+    V b_hi = And(b, mask);
+    V a_lo = Sub(a, a_hi);
+    V b_lo = Sub(b, b_hi);
+    lo = MulSub(a_hi, b_hi, hi);
+    lo = MulAdd(a_lo, b_hi, MulAdd(a_hi, b_lo, lo));
+    lo = MulAdd(a_lo, b_lo, lo);
+  }
+  return hi;
+}
+
+/// (a_hi + a_lo)·(b_hi + b_lo) as a renormalized double-word hi + lo
+template <typename V>
+NPSR_INTRIN V MulDW(V a_hi, V a_lo, V b_hi, V b_lo, V &lo) {
+  using namespace hn;
+  V p_lo;
+  V p_hi = TwoProd(a_hi, b_hi, p_lo);
+  p_lo = MulAdd(a_hi, b_lo, MulAdd(a_lo, b_hi, p_lo));
+  V hi = Add(p_hi, p_lo);
+  lo = Sub(p_lo, Sub(hi, p_hi));
+  return hi;
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_DW_INL_H_
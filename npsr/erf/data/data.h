@@ -0,0 +1,11 @@
+// Aggregates the erf data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Intentionally NOT guarded with #ifndef: it pulls in the Highway
+// target-toggled headers erfc4-inl.h and erfinv-inl.h, which must be
+// re-included once per SIMD target, see npsr/trig/data/data.h. The include-once child (erf)
+// carries its own guard and no-ops on re-entry.
+#include "npsr/lut-inl.h"
+#include "npsr/erf/data/erf.h"
+#include "npsr/erf/data/erfc4-inl.h"
+#include "npsr/erf/data/erfinv-inl.h"
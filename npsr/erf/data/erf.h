@@ -0,0 +1,31 @@
+// Auto-generated by npsr/erf/data/erf.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_ERF_DATA_ERF_H
+#define NPSR_ERF_DATA_ERF_H
+
+namespace npsr::erf::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kErfPoly[] = {};
+// erf degree 9, |x| < 1/2, relative error 2^-29.125
+template <> inline constexpr float kErfPoly<float>[] = {
+0x1.352ee6p-8f, -0x1.b665cep-6f, 0x1.ce2532p-4f, -0x1.812734p-2f, 
+0x1.06eba8p-3f, };
+// erf degree 19, |x| < 1/2, relative error 2^-55.75
+template <> inline constexpr double kErfPoly<double>[] = {
+-0x1.39ec4b661ef8fp-23, 0x1.b774810f738ddp-20, -0x1.f4bb8b06a4dd9p-17, 0x1.f9a2a5f79aac1p-14, 
+-0x1.c02db23c9429ap-11, 0x1.565bcd0aa91fap-8, -0x1.b82ce3127f925p-6, 0x1.ce2f21a042b2fp-4, 
+-0x1.812746b0379e6p-2, 0x1.06eba8214db69p-3, };
+
+template <typename T> inline constexpr char kInvSqrt2[] = {};
+template <> inline constexpr float kInvSqrt2<float>[] = {
+0x1.6a09e6p-1f, 0x1.9fcef4p-27f, };
+template <> inline constexpr double kInvSqrt2<double>[] = {
+0x1.6a09e667f3bcdp-1, -0x1.bdd3413b26456p-55, };
+
+template <typename T> inline constexpr char kTwoDivSqrtPi = '_';
+template <> inline constexpr float kTwoDivSqrtPi<float> = 0x1.20dd76p0f;
+template <> inline constexpr double kTwoDivSqrtPi<double> = 0x1.20dd750429b6dp0;
+
+} // namespace npsr::erf::data
+
+#endif // NPSR_ERF_DATA_ERF_H
@@ -0,0 +1,60 @@
+// Generates the minimax polynomial of the error function kernel
+// (see npsr/erf/erf-inl.h).
+//
+// Below |x| = 1/2 erf is odd and close to 2x/√π, so it takes the same form
+// as asin:
+//   erf(x) ≈ x + x·P(x²),  |x| < 1/2
+// with the leading x kept exact for the kernel to add last. Past the bound
+// the kernels go through erfc and the table of
+// npsr/erf/data/erfc4-inl.h.sol.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Degree of P in x²
+procedure Erf_(pT, pDeg) {
+  var i, $;
+  $.range = [2^-100; 1/2];
+  $.monos = [||];
+  for i from 1 to 2 * pDeg + 1 by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.p = MinimaxCoeffs(pT, erf(x), $.monos, $.range, x);
+  $.array = CArrayT(pT, $.p.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// erf degree " @ (2 * pDeg + 1) @ ", |x| < 1/2" @
+    ", relative error 2^" @ round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kErfPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kErfPoly[] = {};"
+);
+Append @ Erf_(Float32, 4);
+Append @ Erf_(Float64, 9);
+Append(
+  "",
+  // 1/√2 as hi + lo, the normal CDF scales its argument by it
+  "template <typename T> inline constexpr char kInvSqrt2[] = {};",
+  "template <> inline constexpr float kInvSqrt2<float>[] = " @
+  CArrayT(Float32, Constants(1/sqrt(2), [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kInvSqrt2<double>[] = " @
+  CArrayT(Float64, Constants(1/sqrt(2), [|RN, 53, 53|]), 4) @ ";",
+  "",
+  // 2/√π, the derivative of erf at zero
+  "template <typename T> inline constexpr char kTwoDivSqrtPi = '_';",
+  "template <> inline constexpr float kTwoDivSqrtPi<float> = " @
+  single(2/sqrt(pi)) @ "f;",
+  "template <> inline constexpr double kTwoDivSqrtPi<double> = " @
+  double(2/sqrt(pi)) @ ";",
+  ""
+);
+
+WriteCPPHeader("npsr::erf::data");
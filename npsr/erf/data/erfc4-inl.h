@@ -0,0 +1,261 @@
+// Auto-generated by npsr/erf/data/erfc4-inl.h.sol
+// Use `spin sollya -f` to force regeneration
+#if defined(NPSR_ERF_DATA_ERFC4_INL_H) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_ERF_DATA_ERFC4_INL_H
+#undef NPSR_ERF_DATA_ERFC4_INL_H
+#else
+#define NPSR_ERF_DATA_ERFC4_INL_H
+#endif
+
+HWY_BEFORE_NAMESPACE();
+namespace npsr::HWY_NAMESPACE::erf {
+inline constexpr auto kErfcTableF32 = MakeLut<float>(
+// Degree 7 down to 1, then the high and low parts of g(c)
+{
+0x1.1aca2cp1f, 0x1.c4dc12p-5f, -0x1.3973dcp-3f, 0x1.29cbb6p-1f, 
+0x1.13d18ep-7f, 0x1.7b0a54p-8f, -0x1.5d6f52p-7f, -0x1.e9d912p-9f, 
+-0x1.43d4aap-13f, -0x1.4fbee4p-15f, -0x1.9acc98p-16f, -0x1.52055ep-16f, 
+-0x1.08673p-19f, -0x1.5cc7d4p-23f, -0x1.ed8394p-28f, -0x1.907e4ep-28f, 
+-0x1.50b714p-27f, -0x1.bd6256p-30f, -0x1.ef2fep-32f, -0x1.1c2eacp-32f, 
+-0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, 
+-0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, 
+-0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, -0x1.1c2eacp-32f, 
+},
+{
+0x1.4e1b6ep-6f, 0x1.1c5814p-6f, 0x1.7ba444p-7f, 0x1.1dfbc2p-7f, 
+0x1.3fb03ap-8f, 0x1.4fd6cap-9f, 0x1.811a94p-10f, 0x1.9f020ep-11f, 
+0x1.70fab6p-12f, 0x1.1524d4p-13f, 0x1.ce3d7cp-15f, 0x1.9a2166p-16f, 
+0x1.20060ap-17f, 0x1.4dfb68p-19f, 0x1.ccd7p-21f, 0x1.6af2aep-22f, 
+0x1.b7d42ap-24f, 0x1.c32292p-26f, 0x1.20498cp-27f, 0x1.ae6b1ep-29f, 
+0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 
+0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 
+0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 0x1.ae6b1ep-29f, 
+},
+{
+-0x1.198c34p-4f, -0x1.39ff72p-5f, -0x1.a57764p-6f, -0x1.927326p-6f, 
+-0x1.9a5f38p-7f, -0x1.ca2976p-8f, -0x1.ddc222p-9f, -0x1.236f2ep-9f, 
+-0x1.29fa22p-10f, -0x1.f8deeep-12f, -0x1.cfb6eep-13f, -0x1.c8d5e4p-14f, 
+-0x1.6c0ac8p-15f, -0x1.f95bb2p-17f, -0x1.935da2p-18f, -0x1.67b04ep-19f, 
+-0x1.f84e6cp-21f, -0x1.3bf436p-22f, -0x1.da18a4p-24f, -0x1.95598ep-25f, 
+-0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, 
+-0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, 
+-0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, -0x1.95598ep-25f, 
+},
+{
+0x1.b1bc38p-4f, 0x1.3e0d74p-4f, 0x1.d7f5a6p-5f, 0x1.61fbd6p-5f, 
+0x1.d4ee7cp-6f, 0x1.17ee0cp-6f, 0x1.5a0798p-7f, 0x1.b9905cp-8f, 
+0x1.da5526p-9f, 0x1.c2c522p-10f, 0x1.d08008p-11f, 0x1.fff2bp-12f, 
+0x1.cffa64p-13f, 0x1.774bdp-14f, 0x1.59b058p-15f, 0x1.5f885ap-16f, 
+0x1.2536ap-17f, 0x1.ba9b36p-19f, 0x1.867e9ap-20f, 0x1.81f91cp-21f, 
+0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 
+0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 
+0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 0x1.81f91cp-21f, 
+},
+{
+-0x1.8bddc2p-3f, -0x1.2eccc2p-3f, -0x1.d44228p-4f, -0x1.6dbf9p-4f, 
+-0x1.0131dep-4f, -0x1.4bcaa6p-5f, -0x1.ba0ad8p-6f, -0x1.2efe24p-6f, 
+-0x1.68864cp-7f, -0x1.84ea24p-8f, -0x1.c24ca2p-9f, -0x1.143678p-9f, 
+-0x1.219026p-10f, -0x1.15949ap-11f, -0x1.2875d2p-12f, -0x1.5781ecp-13f, 
+-0x1.53c06p-14f, -0x1.3670ep-15f, -0x1.41e63ep-16f, -0x1.6dd41p-17f, 
+-0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, 
+-0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, 
+-0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, -0x1.6dd41p-17f, 
+},
+{
+0x1.482bd8p-2f, 0x1.071da8p-2f, 0x1.aa32b8p-3f, 0x1.5c775ep-3f, 
+0x1.05e724p-3f, 0x1.701342p-4f, 0x1.0a15aep-4f, 0x1.8a6fp-5f, 
+0x1.061568p-5f, 0x1.43b98cp-6f, 0x1.a7eddep-7f, 0x1.22f066p-7f, 
+0x1.62c132p-8f, 0x1.95252cp-9f, 0x1.f75ef8p-10f, 0x1.4d07bcp-10f, 
+0x1.87637ep-11f, 0x1.b1c894p-12f, 0x1.0898f8p-12f, 0x1.59fa2ap-13f, 
+0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 
+0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 
+0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 0x1.59fa2ap-13f, 
+},
+{
+-0x1.e18ab8p-2f, -0x1.97fe7cp-2f, -0x1.5cbc2cp-2f, -0x1.2c84bp-2f, 
+-0x1.e78b36p-3f, -0x1.797a64p-3f, -0x1.2b11e6p-3f, -0x1.e3658p-4f, 
+-0x1.6a70d2p-4f, -0x1.030578p-4f, -0x1.82a852p-5f, -0x1.2aa65p-5f, 
+-0x1.aa3eb6p-6f, -0x1.238ca8p-6f, -0x1.a6e2dp-7f, -0x1.404456p-7f, 
+-0x1.c0466ap-8f, -0x1.2ddd3ep-8f, -0x1.b1be48p-9f, -0x1.467f44p-9f, 
+-0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, 
+-0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, 
+-0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, -0x1.467f44p-9f, 
+},
+{
+0x1.2b84fp-1f, 0x1.0fce4ep-1f, 0x1.f0724p-2f, 0x1.c7f814p-2f, 
+0x1.9531ep-2f, 0x1.5f88f6p-2f, 0x1.3583f6p-2f, 0x1.13e574p-2f, 
+0x1.d94446p-3f, 0x1.8c9eb6p-3f, 0x1.54a7ap-3f, 0x1.2a2af2p-3f, 
+0x1.f5b2ap-4f, 0x1.9d8a9p-4f, 0x1.5f75c4p-4f, 0x1.31743p-4f, 
+0x1.fe6cc4p-5f, 0x1.a273c6p-5f, 0x1.627bccp-5f, 0x1.33714ap-5f, 
+0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 
+0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 
+0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 0x1.33714ap-5f, 
+},
+{
+0x1.db853ep-27f, 0x1.2dbac4p-26f, -0x1.4a640ep-31f, -0x1.f63784p-28f, 
+0x1.362936p-27f, -0x1.a18712p-27f, 0x1.910c9ep-28f, 0x1.db024p-29f, 
+0x1.ac4f26p-28f, 0x1.1fe4fap-28f, 0x1.1a9768p-28f, -0x1.8fadb4p-29f, 
+0x1.273d32p-30f, -0x1.baf61ap-29f, 0x1.74b8b8p-31f, -0x1.64e566p-29f, 
+0x1.41f2a8p-30f, -0x1.037126p-30f, 0x1.3e5a56p-32f, 0x1.204bf4p-36f, 
+0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 
+0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 
+0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 0x1.204bf4p-36f, 
+}
+);
+inline constexpr auto kErfcTableF64 = MakeLut<double>(
+// Degree 13 down to 1, then the high and low parts of g(c)
+{
+-0x1.c422c09c9ba05p-1, -0x1.e070d7a7b3d77p-2, -0x1.a48c7ff01459ap-2, 0x1.5402d9a03b116p-2, 
+-0x1.5ea09a219ed22p-12, 0x1.5142b0a3b0869p-13, -0x1.aea4ac56094a2p-14, 0x1.a26db571415fbp-15, 
+-0x1.6c2fdb493737ep-25, -0x1.0b90b03951989p-25, -0x1.6975a6dc694a8p-27, 0x1.5a4daf2f48eb7p-29, 
+-0x1.f0f79b4e4945p-35, -0x1.55dee1bccae34p-39, -0x1.36627004fd15p-41, 0x1.ec9b77459786cp-43, 
+-0x1.f76c9eb85d117p-47, -0x1.abaca0fd97b7cp-51, -0x1.fe328e6cfc497p-53, -0x1.3caac535372afp-57, 
+-0x1.8a796a08653afp-60, -0x1.46663c2a1eed9p-64, -0x1.c74ad4e901bcep-69, -0x1.dcf925747b802p-71, 
+-0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, 
+-0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, -0x1.dcf925747b802p-71, 
+},
+{
+0x1.06f6cf9fd46bp-9, 0x1.79fd611f8500bp-10, 0x1.66fcd4af990d1p-11, -0x1.b0025a30149e8p-12, 
+0x1.55a25603df79cp-17, 0x1.49a2bd844abcp-19, 0x1.e6c34cb97d1c5p-20, 0x1.6b4c389616917p-22, 
+0x1.4533afe657c1dp-23, 0x1.106a1753d2456p-25, 0x1.046e46f6f3e85p-27, 0x1.095ccb8e9b3cbp-29, 
+0x1.6cdc4686dc3fep-32, 0x1.5b0538d6fec61p-35, 0x1.ad0462c9d774p-38, 0x1.4840dec1dbb9p-40, 
+0x1.346d7f6690487p-43, 0x1.a74e6f7e45034p-47, 0x1.a7c370f00a7e1p-50, 0x1.16bc3759ad8a6p-52, 
+0x1.c6477ffc13784p-56, 0x1.13f3a727cede7p-59, 0x1.00608cdeefb84p-62, 0x1.4220cb00a772dp-65, 
+0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 
+0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 0x1.4220cb00a772dp-65, 
+},
+{
+0x1.a7709350047f5p-7, 0x1.ba6541c6ee0dfp-8, 0x1.86c1d05ef4702p-8, -0x1.44df1351a8a6dp-8, 
+-0x1.73b85671a146cp-17, -0x1.409053281cbafp-16, 0x1.0217e3f81621ep-19, -0x1.4726e2e8fd66cp-18, 
+-0x1.37465fe57b932p-21, -0x1.13a091ddc408fp-23, -0x1.173e9812aeb65p-25, -0x1.65cb95e8bf1e7p-27, 
+-0x1.f51c32d1c4fbdp-30, -0x1.16a5e15d9a108p-32, -0x1.87f40dea5911bp-35, -0x1.5bc06f399cc95p-37, 
+-0x1.67d0d8fc925b8p-40, -0x1.2bd047826faf5p-43, -0x1.5771e490e01aep-46, -0x1.0aafa484899d4p-48, 
+-0x1.f36806c9fdfb3p-52, -0x1.7751d62d948fp-55, -0x1.a06f6d2e040dbp-58, -0x1.2da21e3006ebap-60, 
+-0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, 
+-0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, -0x1.2da21e3006ebap-60, 
+},
+{
+0x1.72847b795cdf1p-11, 0x1.bed71a79fa7abp-12, 0x1.1432d5e20fef4p-12, 0x1.6e47ebbb892ccp-13, 
+0x1.623f0638f3189p-14, 0x1.2598eec1a9cp-15, 0x1.fa090eb7ab49fp-17, 0x1.c90877aac5689p-18, 
+0x1.27a97d822c0b5p-19, 0x1.284f7768291e6p-21, 0x1.4eb3bb5c161acp-23, 0x1.a3cf04e81973fp-25, 
+0x1.5c4aeeda0724fp-27, 0x1.baf618581cf1p-30, 0x1.6449228858b2cp-32, 0x1.594278828eb9ap-34, 
+0x1.b0913ffec692bp-37, 0x1.ad27c1470e518p-40, 0x1.258156902ce61p-42, 0x1.fd4b3560c611ep-45, 
+0x1.1dff17e0e9f17p-47, 0x1.041a081e5ef25p-50, 0x1.51a68f4449a4dp-53, 0x1.1b3aa3a73ac1ap-55, 
+0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 
+0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 0x1.1b3aa3a73ac1ap-55, 
+},
+{
+-0x1.036332285c22ep-9, -0x1.40a9679cb365ep-10, -0x1.992d32fad3c7ep-11, -0x1.d616ba808383cp-12, 
+-0x1.04732b13d06dfp-12, -0x1.c554904c67715p-14, -0x1.9ea4956c383dp-15, -0x1.8687aacc1ee4dp-16, 
+-0x1.117ae3a0691bep-17, -0x1.2dacee9f7a75fp-19, -0x1.754f12ac9b2f5p-21, -0x1.fe2a89ea70535p-23, 
+-0x1.de08b55b73e9fp-25, -0x1.5ffa1bc1cc612p-27, -0x1.42fcfe2be5fb7p-29, -0x1.607d5c4157afap-31, 
+-0x1.02e7aeaf68dbfp-33, -0x1.33eb4b78853d8p-36, -0x1.ec18497cf3a16p-39, -0x1.e8db8991e5193p-41, 
+-0x1.47584635e162ap-43, -0x1.69c149b5a5ac5p-46, -0x1.1494d6436facap-48, -0x1.0b25ef0071595p-50, 
+-0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, 
+-0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, -0x1.0b25ef0071595p-50, 
+},
+{
+0x1.3650df8a38e7cp-8, 0x1.8d656780d8289p-9, 0x1.01b1ca565a618p-9, 0x1.524d6a22dc424p-10, 
+0x1.6fd9bec25153dp-11, 0x1.535f33db471e2p-12, 0x1.465f1bbde2888p-13, 0x1.46318d7c7c155p-14, 
+0x1.ec77446bb5891p-16, 0x1.2bfb611dd9084p-17, 0x1.97dd84bc9bc6fp-19, 0x1.30c2f2e74fe52p-20, 
+0x1.43551d5367b3bp-22, 0x1.149ce4e6b68acp-24, 0x1.22467daffe885p-26, 0x1.657f3a88de16p-28, 
+0x1.342cce638f57p-30, 0x1.b82d6dca22343p-33, 0x1.9b4120490ee5ep-35, 0x1.d445bf6440cbep-37, 
+0x1.75da64eef7f34p-39, 0x1.f68346b45331ep-42, 0x1.c4c5efcfa4b84p-44, 0x1.f7af56131ffbep-46, 
+0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 
+0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 0x1.f7af56131ffbep-46, 
+},
+{
+-0x1.6ff4f96364defp-7, -0x1.e5d21efa94eb8p-8, -0x1.44bb9f5777533p-8, -0x1.b75f36fb9a238p-9, 
+-0x1.f38c3d7b9ad23p-10, -0x1.e8ae971e6be5fp-11, -0x1.f1b3cbd3598a2p-12, -0x1.070e3e5978596p-12, 
+-0x1.aed7eb4a1115ep-14, -0x1.2312ad8b3925ap-15, -0x1.b45cf7fa5cc1ap-17, -0x1.65778f8e3e3a4p-18, 
+-0x1.aef8eb0f42ea4p-20, -0x1.add7b28a6b816p-22, -0x1.028f4883472eep-23, -0x1.67f1593224c8bp-25, 
+-0x1.6ce6636065875p-27, -0x1.397289cd4ead4p-29, -0x1.56cb0789df9bep-31, -0x1.bf9955da0b5d7p-33, 
+-0x1.aa5619e2ceb72p-35, -0x1.5ca8175695326p-37, -0x1.724f212ed041cp-39, -0x1.da8d79b4b7d2cp-41, 
+-0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, 
+-0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, -0x1.da8d79b4b7d2cp-41, 
+},
+{
+0x1.9dcc14c52479ap-6, 0x1.1a31bfc4ba638p-6, 0x1.859d3c921660cp-7, 0x1.102167ff4370cp-7, 
+0x1.446c5160c8363p-8, 0x1.51aba0057464bp-9, 0x1.6d609f53fca62p-10, 0x1.99b60e52cc4a3p-11, 
+0x1.6d7743d11ae4p-12, 0x1.131bb15eba469p-13, 0x1.c882f01e2c29ap-15, 0x1.9b50d0d6328e6p-16, 
+0x1.1ad6a316e0fe2p-17, 0x1.4a17e192addeep-19, 0x1.c871a15c6a228p-21, 0x1.67ca2bf872ca4p-22, 
+0x1.adc5f795dd698p-24, 0x1.bcbee284a2fabp-26, 0x1.1cf1ff64b68f1p-27, 0x1.aaf0d3b946666p-29, 
+0x1.e578444cf0d93p-31, 0x1.e35421b0bdd55p-33, 0x1.2ea50cf8f432ep-34, 0x1.bedc4e955ab17p-36, 
+0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 
+0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 0x1.bedc4e955ab17p-36, 
+},
+{
+-0x1.b6594326d9babp-5, -0x1.358dce3e48a97p-5, -0x1.ba6d69380df29p-6, -0x1.3fc8364f0ce06p-6, 
+-0x1.910a5d8245ff3p-7, -0x1.bdf24bc6964cp-8, -0x1.014eae31c46cap-8, -0x1.33237c3692d29p-9, 
+-0x1.2bd251bb4dde1p-10, -0x1.f99e41eeee7f2p-12, -0x1.d25ebba492934p-13, -0x1.cfcdea19f95acp-14, 
+-0x1.6d54b13368e8dp-15, -0x1.f4e46d14d8c3ep-17, -0x1.8f23fecb35e4dp-18, -0x1.64fcbb6d4b72cp-19, 
+-0x1.f773505bcd524p-21, -0x1.3a555d78ce2fbp-22, -0x1.d868cc73ea173p-24, -0x1.96605f1d54705p-25, 
+-0x1.13fdbd8e49a89p-26, -0x1.4eabfd6622333p-28, -0x1.ee543f8f3ee6fp-30, -0x1.a48dc573915f7p-31, 
+-0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, 
+-0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, -0x1.a48dc573915f7p-31, 
+},
+{
+0x1.b1a22aa7abd59p-4, 0x1.3e0e0ed6b8e8ap-4, 0x1.d7f26045a5906p-5, 0x1.61fee765fd054p-5, 
+0x1.d4e711a2e0f16p-6, 0x1.17eba60d310c8p-6, 0x1.5a142948ac8fap-7, 0x1.b99589d40d197p-8, 
+0x1.da595561f8ab6p-9, 0x1.c2c72fd7284b8p-10, 0x1.d085857a19134p-11, 0x1.fff032a0dec36p-12, 
+0x1.d00785f2fbe37p-13, 0x1.774f4826df93p-14, 0x1.59b29296c5506p-15, 0x1.5f8a69c9dd641p-16, 
+0x1.25438103a9206p-17, 0x1.baa1d9d84c444p-19, 0x1.8682d21858c9cp-20, 0x1.81fb2ba7eb712p-21, 
+0x1.3955a9a7cc3cfp-22, 0x1.cf017aa14dcd4p-24, 0x1.936a6b39af5d3p-25, 0x1.8b940e583cb6ep-26, 
+0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 
+0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 0x1.8b940e583cb6ep-26, 
+},
+{
+-0x1.8bed65e015c05p-3, -0x1.2ecd75f4cfadbp-3, -0x1.d43ed8ca5c454p-4, -0x1.6dcc9e7a2d953p-4, 
+-0x1.01343a2c91c8fp-4, -0x1.4bcdb9d908975p-5, -0x1.ba018e6426aeep-6, -0x1.2ef92f6f11131p-6, 
+-0x1.6883f9919a10fp-7, -0x1.84e9ab30e66fbp-8, -0x1.c24b49c479d84p-9, -0x1.1434ae05874a1p-9, 
+-0x1.218ed930b256p-10, -0x1.15976ddda413dp-11, -0x1.28787f0e7f83ep-12, -0x1.5783a27fadba4p-13, 
+-0x1.53c131b5cb47fp-14, -0x1.3672f09812679p-15, -0x1.41e750b2e0159p-16, -0x1.6dd369db39397p-17, 
+-0x1.63325936577cbp-18, -0x1.3ff35b4b9e4acp-19, -0x1.48fb6bc697ce9p-20, -0x1.73e1a60e21f6cp-21, 
+-0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, 
+-0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, -0x1.73e1a60e21f6cp-21, 
+},
+{
+0x1.482bd9fad9ecep-2, 0x1.071da7f78298cp-2, 0x1.aa32b83507191p-3, 0x1.5c775dfc44979p-3, 
+0x1.05e72521ca1b7p-3, 0x1.701342cbcea7cp-4, 0x1.0a15ac2adab33p-4, 0x1.8a6efeed233aep-5, 
+0x1.0615670e25a7ap-5, 0x1.43b98bac83822p-6, 0x1.a7eddc9ee6424p-7, 0x1.22f0664f3cbf9p-7, 
+0x1.62c12cb5f755dp-8, 0x1.95252b932efddp-9, 0x1.f75ef7a0fb2dbp-10, 0x1.4d07bba601412p-10, 
+0x1.876373f4a0ed5p-11, 0x1.b1c8923879d76p-12, 0x1.0898f73586fccp-12, 0x1.59fa2994d54efp-13, 
+0x1.920b4fb0716d3p-14, 0x1.b9bd9f029a778p-15, 0x1.0c15fcc6f7fe8p-15, 0x1.5d6955b46bd2ap-16, 
+0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 
+0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 0x1.5d6955b46bd2ap-16, 
+},
+{
+-0x1.e18ab7052be7fp-2, -0x1.97fe7bf1c60fp-2, -0x1.5cbc2c216dfp-2, -0x1.2c84af7c10e14p-2, 
+-0x1.e78b356770fbbp-3, -0x1.797a639d8129dp-3, -0x1.2b11e6959934cp-3, -0x1.e36580c7f734ap-4, 
+-0x1.6a70d2bb37411p-4, -0x1.0305781330099p-4, -0x1.82a8522b868a1p-5, -0x1.2aa6503acda11p-5, 
+-0x1.aa3eb6a946f7ep-6, -0x1.238ca71b93fc3p-6, -0x1.a6e2cf277a0cbp-7, -0x1.404455ba9f3bep-7, 
+-0x1.c046699d77d51p-8, -0x1.2ddd3d589bfbp-8, -0x1.b1be47a913fc3p-9, -0x1.467f441a50cf9p-9, 
+-0x1.c661852c5133ap-10, -0x1.30a253d642e9cp-10, -0x1.b49a775427ef7p-11, -0x1.481e34f76a622p-11, 
+-0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, 
+-0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, -0x1.481e34f76a622p-11, 
+},
+{
+0x1.2b84f076e14fbp-1, 0x1.0fce4e96dd619p-1, 0x1.f0723ff5acdf9p-2, 0x1.c7f81382721efp-2, 
+0x1.9531e09b149b5p-2, 0x1.5f88f52f3c76bp-2, 0x1.3583f6644327bp-2, 0x1.13e5743b6048p-2, 
+0x1.d94446d627932p-3, 0x1.8c9eb68ff27d7p-3, 0x1.54a7a08d4bb45p-3, 0x1.2a2af19c1493p-3, 
+0x1.f5b2a049cf4c6p-4, 0x1.9d8a8f2284f2cp-4, 0x1.5f75c42e97171p-4, 0x1.31742f4d8d4d3p-4, 
+0x1.fe6cc4a0f9538p-5, 0x1.a273c57e476cep-5, 0x1.627bcc27cb4aep-5, 0x1.33714a024097ep-5, 
+0x1.005fe090c5e5dp-5, 0x1.a3bc12161d4ebp-6, 0x1.63438bf2c3ee9p-6, 0x1.33f3abfd60d6fp-6, 
+0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 
+0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 0x1.33f3abfd60d6fp-6, 
+},
+{
+0x1.b8bd1accf8123p-55, -0x1.7210607953137p-57, -0x1.7b669ffa31576p-58, -0x1.3f947ee724dfcp-62, 
+-0x1.aa513235e9c37p-58, -0x1.b7eb97a02d0e7p-57, -0x1.88eb8ebfdccaep-56, 0x1.ca1dfca5d5331p-56, 
+-0x1.a8198a8216449p-58, -0x1.bb4e763c64a35p-57, -0x1.6a0d91336bdc9p-61, -0x1.fa04a06a33f29p-57, 
+-0x1.fc4bbbfb1695ap-58, -0x1.5b0277fa1ecb8p-58, -0x1.a1eaaa8191c3p-58, -0x1.f82bc955e371ap-59, 
+0x1.c95be62ca9a6dp-59, -0x1.6d026e15898ddp-59, -0x1.d520e73ec05a6p-60, 0x1.f3b4d0ae3b609p-59, 
+-0x1.4a17d4faf57bp-59, -0x1.b352d33781d73p-61, -0x1.1fc7374725534p-61, 0x1.060d74c72796bp-60, 
+0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 
+0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 0x1.060d74c72796bp-60, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_ERF_DATA_ERFC4_INL_H(){}
+} // namespace npsr::HWY_NAMESPACE::erf
+HWY_AFTER_NAMESPACE();
+#endif // NPSR_ERF_DATA_ERFC4_INL_H
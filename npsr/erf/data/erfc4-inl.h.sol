@@ -0,0 +1,68 @@
+// Generates the lookup table of the complementary error function kernel
+// (see npsr/erf/erf-inl.h).
+//
+// Past |x| = 1/2 the kernel computes erfc(x) = e^(-x²)·g(x), where
+//   g(x) = erfc(x)·e^(x²)
+// is smooth and slowly varying. [1/2, 2^kOctaves/2) is split in four
+// intervals per octave, the top two mantissa bits of x past the leading
+// one, and each interval gets its own minimax polynomial in t = x - c,
+// c the midpoint of the interval, so t is exact:
+//   g(c + t) ≈ g(c) + t·P(t)
+// g(c) is stored as high and low parts, the kernel adds t·P(t) to them
+// without rounding. The columns are the intervals, padded to 32 with the
+// last one, and the rows the coefficients from the highest degree down,
+// then the high and low parts of g(c).
+//
+// Parameters:
+//   pT       - Type descriptor (Float32 or Float64)
+//   pDeg     - Degree of the polynomials
+//   pOctaves - Number of octaves covered from 1/2
+procedure ErfcTable_(pT, pDeg, pOctaves) {
+  var rows, o, i, j, k, $;
+  $.g = erfc(x) * exp(x^2);
+  $.monos = [||];
+  for i from 1 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  rows = [||];
+  for i from 0 to pDeg + 1 do {
+    rows = rows :. [||];
+  };
+  for j from 0 to 31 do {
+    k = min(j, 4 * pOctaves - 1);
+    o = floor(k / 4);
+    $.width = 2^o / 8;
+    $.mid = 2^(o - 1) * (1 + (k - 4 * o) / 4) + $.width / 2;
+    $.c0 = $.g($.mid);
+    $.c0_hi = pT.kRound($.c0);
+    $.c0_lo = pT.kRound($.c0 - $.c0_hi);
+    $.p = MinimaxCoeffs(pT, substitute($.g, $.mid + x), $.monos,
+                        [-$.width / 2; $.width / 2], $.c0_hi + $.c0_lo);
+    for i from 0 to pDeg - 1 do {
+      rows[i] = rows[i] :. $.p.coeffs[i];
+    };
+    rows[pDeg] = rows[pDeg] :. $.c0_hi;
+    rows[pDeg + 1] = rows[pDeg + 1] :. $.c0_lo;
+  };
+  $.lines = [||];
+  for i from 0 to pDeg + 1 do {
+    $.lines = $.lines :. (CArrayT(pT, rows[i], 4) @
+                          (if (i <= pDeg) then "," else ""));
+  };
+  return $.lines;
+};
+
+Append(
+  "inline constexpr auto kErfcTableF32 = MakeLut<float>(",
+  "// Degree 7 down to 1, then the high and low parts of g(c)"
+);
+Append @ ErfcTable_(Float32, 7, 5);
+Append(
+  ");",
+  "inline constexpr auto kErfcTableF64 = MakeLut<double>(",
+  "// Degree 13 down to 1, then the high and low parts of g(c)"
+);
+Append @ ErfcTable_(Float64, 13, 6);
+Append(");");
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::erf");
@@ -0,0 +1,129 @@
+// Auto-generated by npsr/erf/data/erfinv-inl.h.sol
+// Use `spin sollya -f` to force regeneration
+#if defined(NPSR_ERF_DATA_ERFINV_INL_H) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_ERF_DATA_ERFINV_INL_H
+#undef NPSR_ERF_DATA_ERFINV_INL_H
+#else
+#define NPSR_ERF_DATA_ERFINV_INL_H
+#endif
+
+HWY_BEFORE_NAMESPACE();
+namespace npsr::HWY_NAMESPACE::erf {
+inline constexpr auto kErfInvTableF32 = MakeLut<float>(
+// Degree 8 down to 0
+{
+0x1.09a584p-24f, 0x1.f4ac94p-24f, -0x1.6d0914p-26f, -0x1.7e1954p-30f, 
+0x1.bbad1p-34f, -0x1.50f408p-41f, -0x1.0f6f3ap-48f, -0x1.8f24eap-56f, 
+},
+{
+-0x1.fb80aep-21f, -0x1.28b29cp-24f, 0x1.d5dbaep-22f, -0x1.86051p-25f, 
+-0x1.0d47bep-31f, 0x1.415d66p-36f, 0x1.f6d8ccp-43f, 0x1.6e79d6p-49f, 
+},
+{
+-0x1.9e412p-20f, -0x1.688beap-18f, -0x1.d5b6a4p-20f, 0x1.7fd946p-21f, 
+-0x1.4141d4p-27f, -0x1.0ad75ep-31f, -0x1.93cd86p-37f, -0x1.22eb52p-42f, 
+},
+{
+0x1.8c902cp-15f, 0x1.86b92p-16f, -0x1.aa6132p-17f, -0x1.614cdap-18f, 
+0x1.16b9f8p-22f, 0x1.126c66p-26f, 0x1.979594p-31f, 0x1.238f9p-35f, 
+},
+{
+-0x1.1b4412p-17f, 0x1.74997ap-13f, 0x1.991306p-13f, 0x1.dacd4cp-17f, 
+-0x1.6e82acp-18f, -0x1.2fa45ap-21f, -0x1.bb984ap-25f, -0x1.3b7356p-28f, 
+},
+{
+-0x1.43fdd8p-9f, -0x1.123eep-9f, -0x1.b666c4p-11f, 0x1.0c1868p-12f, 
+0x1.e84856p-14f, 0x1.734d5ep-16f, 0x1.0b0dc6p-18f, 0x1.79e998p-21f, 
+},
+{
+0x1.03545ap-7f, 0x1.cd4006p-11f, -0x1.780dfp-8f, -0x1.b39b66p-8f, 
+-0x1.835e22p-9f, -0x1.19c2f6p-10f, -0x1.905c52p-12f, -0x1.1a5fbcp-13f, 
+},
+{
+0x1.ef212cp-3f, 0x1.005f04p-2f, 0x1.eedbecp-3f, 0x1.990bbp-3f, 
+0x1.29b5acp-3f, 0x1.a65c72p-4f, 0x1.2a2a7ep-4f, 0x1.a49a1p-5f, 
+},
+{
+0x1.013c1p0f, 0x1.408742p0f, 0x1.9fa072p0f, 0x1.24a98ep1f, 
+0x1.a6505ap1f, 0x1.2fdcaep2f, 0x1.b2fb8cp2f, 0x1.35fecp3f, 
+}
+);
+inline constexpr auto kErfInvTableF64 = MakeLut<double>(
+// Degree 11 down to 0
+{
+-0x1.a738b1a6f4954p-32, 0x1.460d0b20f7c45p-32, -0x1.9f983a3877f28p-36, 0x1.b70edaa1e46e5p-38, 
+-0x1.2d88be6963b22p-44, 0x1.8902730d02c41p-56, 0x1.9a7c04f86fe0ep-66, 0x1.3717288632903p-76, 
+0x1.c035dc199a101p-87, 0x1.3d095421acb5dp-97, 0x1.be4f6e5a7e126p-108, 0x1.be4f6e5a7e126p-108, 
+0x1.be4f6e5a7e126p-108, 0x1.be4f6e5a7e126p-108, 0x1.be4f6e5a7e126p-108, 0x1.be4f6e5a7e126p-108, 
+},
+{
+-0x1.0821fee1b92ep-29, -0x1.133d264a10462p-29, 0x1.23116b4bfbd58p-30, -0x1.c88754226e28cp-34, 
+0x1.1991ec28bbf87p-40, -0x1.88ee4b882d9fbp-51, -0x1.675d477c4c6b6p-60, -0x1.0da0f9c728971p-69, 
+-0x1.83014abef933fp-79, -0x1.116e53e10ef47p-88, -0x1.80dd40b93264dp-98, -0x1.80dd40b93264dp-98, 
+-0x1.80dd40b93264dp-98, -0x1.80dd40b93264dp-98, -0x1.80dd40b93264dp-98, -0x1.80dd40b93264dp-98, 
+},
+{
+0x1.4e4474f17ba9fp-26, -0x1.f0e1719ed1973p-28, -0x1.784c283c6981cp-28, 0x1.8e2ede973fbp-31, 
+-0x1.35f3da536790fp-37, 0x1.2e0f3739d6287p-46, 0x1.e430f9ef2423ap-55, 0x1.657ddf1cce538p-63, 
+0x1.fe0bf415b68dep-72, 0x1.67bc8e1373c15p-80, 0x1.fa40ea6efd9bbp-89, 0x1.fa40ea6efd9bbp-89, 
+0x1.fa40ea6efd9bbp-89, 0x1.fa40ea6efd9bbp-89, 0x1.fa40ea6efd9bbp-89, 0x1.fa40ea6efd9bbp-89, 
+},
+{
+0x1.0e4a1d6391095p-24, 0x1.f98327fc2cce5p-24, -0x1.95f786205bc57p-26, -0x1.f530785d8bf8p-32, 
+0x1.1d4a3df654a0bp-34, -0x1.19b25ce519515p-41, -0x1.b9cd934f73fa9p-49, -0x1.4350b42cab29bp-56, 
+-0x1.cbda1ac7d4efap-64, -0x1.44145805ad5dep-71, -0x1.c81599722604p-79, -0x1.c81599722604p-79, 
+-0x1.c81599722604p-79, -0x1.c81599722604p-79, -0x1.c81599722604p-79, -0x1.c81599722604p-79, 
+},
+{
+-0x1.00aadcde8bbf3p-20, -0x1.177f75f93fd6ep-24, 0x1.e32c47d57d18ap-22, -0x1.c0e8d9069fbdp-25, 
+-0x1.f90d1228636b9p-34, 0x1.11b506fb85f27p-36, 0x1.a7f04b7f1797bp-43, 0x1.34012cb28bda5p-49, 
+0x1.b506c04391b77p-56, 0x1.33d6126c1feb6p-62, 0x1.b145f3833883cp-69, 0x1.b145f3833883cp-69, 
+0x1.b145f3833883cp-69, 0x1.b145f3833883cp-69, 0x1.b145f3833883cp-69, 0x1.b145f3833883cp-69, 
+},
+{
+-0x1.9e4f0d60a8ebep-20, -0x1.688f8b0fd6504p-18, -0x1.d53bde107c331p-20, 0x1.7e581baa7d904p-21, 
+-0x1.32669e2ead8afp-27, -0x1.0d6ecbe2fd40fp-31, -0x1.988b2db1041f8p-37, -0x1.2679ecbde9e5cp-42, 
+-0x1.a0c4cdfe0df36p-48, -0x1.256ded0a58883p-53, -0x1.9d13561ff7bd6p-59, -0x1.9d13561ff7bd6p-59, 
+-0x1.9d13561ff7bd6p-59, -0x1.9d13561ff7bd6p-59, -0x1.9d13561ff7bd6p-59, -0x1.9d13561ff7bd6p-59, 
+},
+{
+0x1.8c9489bdeaed4p-15, 0x1.86b5eb732f71fp-16, -0x1.aab13f6837ad6p-17, -0x1.5fe6098bc2233p-18, 
+0x1.11a904c05955p-22, 0x1.14bbdc0f84173p-26, 0x1.9b714f8e7af07p-31, 0x1.266c2aed209d9p-35, 
+0x1.9fcc2687e08aep-40, 0x1.24abfaabc6a96p-44, 0x1.9c22c24b81ab3p-49, 0x1.9c22c24b81ab3p-49, 
+0x1.9c22c24b81ab3p-49, 0x1.9c22c24b81ab3p-49, 0x1.9c22c24b81ab3p-49, 0x1.9c22c24b81ab3p-49, 
+},
+{
+-0x1.1b43f3f6c36aap-17, 0x1.74997cbb3029bp-13, 0x1.9912c14397522p-13, 0x1.dae807a5164bp-17, 
+-0x1.6ea3c19046412p-18, -0x1.2f98ce598d616p-21, -0x1.bb83264a10a06p-25, -0x1.3b6378e27f914p-28, 
+-0x1.bcb0a88983db9p-32, -0x1.3904825b65d54p-35, -0x1.b8fbfa8829351p-39, -0x1.b8fbfa8829351p-39, 
+-0x1.b8fbfa8829351p-39, -0x1.b8fbfa8829351p-39, -0x1.b8fbfa8829351p-39, -0x1.b8fbfa8829351p-39, 
+},
+{
+-0x1.43fdd851b601fp-9, -0x1.123ee0112951dp-9, -0x1.b6666b146202ep-11, 0x1.0c122249a6b65p-12, 
+0x1.e85f4c139e688p-14, 0x1.7342f31242892p-16, 0x1.0b050c57854a7p-18, 0x1.79dca48221711p-21, 
+0x1.0a2408a666591p-23, 0x1.76d14d1a58313p-26, 0x1.0830f3a872ff3p-28, 0x1.0830f3a872ff3p-28, 
+0x1.0830f3a872ff3p-28, 0x1.0830f3a872ff3p-28, 0x1.0830f3a872ff3p-28, 0x1.0830f3a872ff3p-28, 
+},
+{
+0x1.03545a4824015p-7, 0x1.cd40055a3e0b8p-11, -0x1.780def1dea1ccp-8, -0x1.b39b6a5989839p-8, 
+-0x1.835e0dcbfd746p-9, -0x1.19c2fcda652fcp-10, -0x1.905c5ecf43262p-12, -0x1.1a5fc50f5ef95p-13, 
+-0x1.8dca7dcfa6b61p-15, -0x1.185ce1f82bf4bp-16, -0x1.8b94869c7435ap-18, -0x1.8b94869c7435ap-18, 
+-0x1.8b94869c7435ap-18, -0x1.8b94869c7435ap-18, -0x1.8b94869c7435ap-18, -0x1.8b94869c7435ap-18, 
+},
+{
+0x1.ef212c8f3a671p-3, 0x1.005f034b91d73p-2, 0x1.eedbebdce73bap-3, 0x1.990bb03e18821p-3, 
+0x1.29b5a985d3f5dp-3, 0x1.a65c74462e1c2p-4, 0x1.2a2a80331d646p-4, 0x1.a49a14a08392ap-5, 
+0x1.28c561bd3d5f8p-5, 0x1.a30f245a39747p-6, 0x1.28071bb3900e7p-6, 0x1.28071bb3900e7p-6, 
+0x1.28071bb3900e7p-6, 0x1.28071bb3900e7p-6, 0x1.28071bb3900e7p-6, 0x1.28071bb3900e7p-6, 
+},
+{
+0x1.013c0f35f5f18p0, 0x1.4087417fcf5eep0, 0x1.9fa072ed72de1p0, 0x1.24a98e2365294p1, 
+0x1.a65059e7fa781p1, 0x1.2fdcadae0e764p2, 0x1.b2fb8b9125f92p2, 0x1.35fec050ce4ecp3, 
+0x1.b8810e0ea87dbp3, 0x1.385e3eb33f527p4, 0x1.ba7af9df2a76bp4, 0x1.ba7af9df2a76bp4, 
+0x1.ba7af9df2a76bp4, 0x1.ba7af9df2a76bp4, 0x1.ba7af9df2a76bp4, 0x1.ba7af9df2a76bp4, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_ERF_DATA_ERFINV_INL_H(){}
+} // namespace npsr::HWY_NAMESPACE::erf
+HWY_AFTER_NAMESPACE();
+#endif // NPSR_ERF_DATA_ERFINV_INL_H
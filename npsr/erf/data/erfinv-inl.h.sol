@@ -0,0 +1,75 @@
+// Generates the lookup table of the inverse error function kernel
+// (see npsr/erf/erfinv-inl.h).
+//
+// The kernel writes erfinv(a) = a·P(w) with w = -log(1 - a²), after Giles,
+// "Approximating the erfinv function". P is smooth in w from the center
+// out to the deepest tails, w ≈ 744 at the smallest double, and nearly
+// scale invariant, so one polynomial per octave of w does, [0, 1) being
+// the first. Each is in u = w - c, c the midpoint of the octave, exact
+// as both share the binade. The columns are the octaves, padded with the
+// last one, and the rows the coefficients from the highest degree down.
+//
+// Sollya has no inverse error function, so P is evaluated by mpmath
+// through PyEval, erfinv directly near the center and Newton's iteration
+// on log(erfc) in the tails, and fitted by a Chebyshev series, within a
+// few tenths of a bit of the minimax error: 2^-24.1 (float, degree 8),
+// 2^-35.9 (double, degree 11), which the kernel's Newton step refines.
+//
+// Parameters:
+//   pT     - Type descriptor (Float32 or Float64)
+//   pDeg   - Degree of the polynomials
+//   pOcts  - Number of octaves of w, the first being [0, 1)
+//   pCols  - Number of columns, pOcts padded to suit the vector lengths
+procedure ErfInvTable_(pT, pDeg, pOcts, pCols) {
+  var i, r, v, $;
+  $.rows = PyEval(
+    "import mpmath as mp",
+    "mp.mp.prec = 160",
+    "def P(w):",
+    "    if w == 0: return mp.sqrt(mp.pi) / 2",
+    "    if w < 4:",
+    "        a = mp.sqrt(-mp.expm1(-w))",
+    "        return mp.erfinv(a) / a",
+    "    e = mp.exp(-w); a = mp.sqrt(1 - e); lt = mp.log(e / (1 + a))",
+    "    x = mp.sqrt(w)",
+    "    for _ in range(60):",
+    "        r = mp.erfc(x)",
+    "        x = x + (mp.log(r) - lt) * r * mp.sqrt(mp.pi) / 2 * mp.exp(x * x)",
+    "    return x / a",
+    "cols = []",
+    "for k in range(" @ pOcts @ "):",
+    "    lo, hi = (mp.mpf(0), mp.mpf(1)) if k == 0 else (mp.mpf(2)**(k-1), mp.mpf(2)**k)",
+    "    c = (lo + hi) / 2",
+    "    cols.append(mp.chebyfit(lambda u: P(c + u), [lo - c, hi - c], " @
+    (pDeg + 1) @ "))",
+    "cols += [cols[-1]] * (" @ pCols @ " - len(cols))",
+    "rows = ['[|' + ', '.join(mp.nstr(col[i], 40) for col in cols) + '|]'",
+    "        for i in range(" @ (pDeg + 1) @ ")]",
+    "print('[|' + ', '.join(rows) + '|]')"
+  );
+  $.rows = parse($.rows);
+  $.lines = [||];
+  for i from 0 to pDeg do {
+    r = [||];
+    for v in $.rows[i] do {
+      r = r :. pT.kRound(v);
+    };
+    $.lines = $.lines :. (CArrayT(pT, r, 4) @ (if (i < pDeg) then "," else ""));
+  };
+  return $.lines;
+};
+
+Append(
+  "inline constexpr auto kErfInvTableF32 = MakeLut<float>(",
+  "// Degree 8 down to 0"
+);
+Append @ ErfInvTable_(Float32, 8, 8, 8);
+Append(
+  ");",
+  "inline constexpr auto kErfInvTableF64 = MakeLut<double>(",
+  "// Degree 11 down to 0"
+);
+Append @ ErfInvTable_(Float64, 11, 11, 16);
+Append(");");
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::erf");
@@ -0,0 +1,287 @@
+#if defined(NPSR_ERF_ERF_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_ERF_ERF_INL_H_
+#undef NPSR_ERF_ERF_INL_H_
+#else
+#define NPSR_ERF_ERF_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoProd
+#include "npsr/erf/data/data.h"
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReduced, Pow2I, Ldexp
+#include "npsr/hwy.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::erf {
+
+// Operation type of the error function kernels and their inverses
+enum class Operation {
+  kErf = 0,
+  kErfc = 1,
+  kNormCdf = 2,
+  kErfInv = 3,
+  kNormQuantile = 4
+};
+
+// Bound of the erf polynomial, see npsr/erf/data/erf.h.sol
+template <typename T>
+inline constexpr T kErfPolyBound = static_cast<T>(0.5);
+
+/**
+ * Bound past which erfc(x) rounds to zero, 27.25 (double) and 10.1 (float).
+ * Arguments are clamped to it, which keeps x² within the range of
+ * exponential::Reduce<> and the interval index within the table.
+ */
+template <typename T>
+inline constexpr T kErfcBound = std::is_same_v<T, float> ? 10.1f : 27.25;
+
+/// Horner over per-lane coefficients loaded from a table, highest first
+template <typename V>
+NPSR_INTRIN V HornerLanes(V, V c) {
+  return c;
+}
+template <typename V, typename... Rest>
+NPSR_INTRIN V HornerLanes(V t, V c_top, V c_next, Rest... rest) {
+  return HornerLanes(t, hn::MulAdd(c_top, t, c_next), rest...);
+}
+
+/**
+ * This function computes erf(x) ≈ x + x·P(x²) for |x| < 1/2 with a minimax
+ * polynomial generated by npsr/erf/data/erf.h.sol, as a double-word hi + lo,
+ * the fast two-sum being valid as |x·P(x²)| < |x|.
+ */
+template <typename V>
+NPSR_INTRIN V ErfPoly(V x, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::erf::data;
+  using T = TFromV<V>;
+  V p = Mul(x, Poly(Mul(x, x), data::kErfPoly<T>));
+  V hi = Add(x, p);
+  lo = Sub(p, Sub(hi, x));
+  return hi;
+}
+
+/**
+ * This function computes g(a) = erfc(a)·e^(a²) for 1/2 ≤ a_hi ≤ kErfcBound<>
+ * as a double-word hi + lo, a = a_hi + a_lo.
+ *
+ * The top two mantissa bits of a_hi past the leading one pick a quarter of
+ * an octave, whose polynomial is loaded through Lut, see
+ * npsr/erf/data/erfc4-inl.h.sol. Its argument t = a_hi - c, c the midpoint
+ * of the interval, is exact as both share the binade, and a_lo joins it
+ * after, so g(c + t) = g(c) + t·P(t) with g(c) stored as high and low parts.
+ * |t·P(t)| stays below ~g(c)/8, so its rounding is far below the ULP.
+ * Without kHigh, g(c) is only rounded once into the sum.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V ErfcPoly(V a_hi, V a_lo, V &lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using TU = hwy::MakeUnsigned<T>;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+
+  const auto bits = BitCast(du, a_hi);
+  const auto idx = ShiftRight<kMantBits - 2>(
+      Sub(bits, BitCast(du, Set(d, kErfPolyBound<T>))));
+  constexpr TU kQuarterMask = (TU{1} << (kMantBits - 2)) - 1;
+  const V mid = BitCast(d, Or(And(bits, Set(du, static_cast<TU>(~kQuarterMask))),
+                              Set(du, TU{1} << (kMantBits - 3))));
+  const V t = Add(Sub(a_hi, mid), a_lo);
+
+  V c0_hi, c0_lo, tp;
+  if constexpr (std::is_same_v<T, float>) {
+    V c7, c6, c5, c4, c3, c2, c1;
+    kErfcTableF32.Load(idx, c7, c6, c5, c4, c3, c2, c1, c0_hi, c0_lo);
+    tp = Mul(t, HornerLanes(t, c7, c6, c5, c4, c3, c2, c1));
+  } else {
+    V c13, c12, c11, c10, c9, c8, c7, c6, c5, c4, c3, c2, c1;
+    kErfcTableF64.Load(idx, c13, c12, c11, c10, c9, c8, c7, c6, c5, c4, c3,
+                       c2, c1, c0_hi, c0_lo);
+    tp = Mul(t, HornerLanes(t, c13, c12, c11, c10, c9, c8, c7, c6, c5, c4,
+                            c3, c2, c1));
+  }
+  if constexpr (kHigh) {
+    V hi = Add(c0_hi, tp);
+    lo = Add(Sub(c0_hi, hi), Add(tp, c0_lo));
+    return hi;
+  } else {
+    lo = Zero(d);
+    return Add(c0_hi, Add(tp, c0_lo));
+  }
+}
+
+/**
+ * This function computes erfc(a) = 2^m·(hi + lo), hi + lo ∈ (0.01, 1.3),
+ * for 1/2 ≤ a_hi ≤ kErfcBound<>, a = a_hi + a_lo.
+ *
+ * Algorithm Overview:
+ * 1. Square: s = a² as a double-word by TwoProd<>. Rounding it would
+ *    cost up to ~2^-44 in the exponent near the bound, hundreds of ULP, so
+ *    both tiers keep it.
+ *
+ * 2. Exponential: e^-s = 2^m·e through exponential::Reduce<>, with the low
+ *    part of s joining the reduced argument
+ *
+ * 3. Tail: erfc(a) = e^-s·g(a), see ErfcPoly<>
+ *
+ * With kHigh, e comes from the table as a double-word, see
+ * exponential::ExpReducedDW<>, and the product is kept unrounded, so the
+ * result rounds once on top of terms ~2^-3 ULP, ~0.75 ULP error. Otherwise
+ * e uses the polynomial over |r| ≤ ln2/2 and the product rounds, ~2 ULP
+ * error.
+ */
+template <bool kHigh, typename V, typename VI>
+NPSR_INTRIN V ErfcTail(V a_hi, V a_lo, VI &m, V &lo) {
+  using namespace hn;
+  using exponential::Operation;
+  const DFromV<V> d;
+
+  V s_lo;
+  V s_hi = TwoProd(a_hi, a_hi, s_lo);
+  s_lo = MulAdd(Add(a_hi, a_hi), a_lo, s_lo);
+  V r_hi, r_lo;
+  VI k = exponential::Reduce<Operation::kExp, kHigh>(Neg(s_hi), r_hi, r_lo);
+  const V r = Add(r_hi, Sub(r_lo, s_lo));
+
+  V g_lo;
+  V g_hi = ErfcPoly<kHigh>(a_hi, a_lo, g_lo);
+  if constexpr (kHigh) {
+    V e_lo;
+    V e_hi = exponential::ExpReducedDW(k, r, m, e_lo);
+    V p_lo;
+    V p_hi = TwoProd(e_hi, g_hi, p_lo);
+    lo = MulAdd(e_hi, g_lo, MulAdd(e_lo, g_hi, p_lo));
+    return p_hi;
+  } else {
+    lo = Zero(d);
+    return Mul(exponential::ExpReduced<false>(k, r, m), g_hi);
+  }
+}
+
+/**
+ * This function computes erf(x), erfc(x) or the standard normal CDF
+ * Φ(x) = erfc(-x/√2)/2, NaN aside.
+ *
+ * Algorithm Overview:
+ * 1. Argument: x is clamped to where every result has settled, so ±∞ need
+ *    no special handling, then z = x, or x/√2 as a double-word for Φ
+ *
+ * 2. Small |z| < 1/2: w = erf(z) as a double-word, see ErfPoly<>, then
+ *    erfc = 1 - w and Φ = (1 + w)/2 by two-sum. For Φ, the low part of z
+ *    adds z_lo·erf'(z).
+ *
+ * 3. Tail |z| ≥ 1/2: v = erfc(|z|), see ErfcTail<>, halved for Φ, then
+ *    - erf = ±(1 - v)
+ *    - erfc = v for x > 0 and 2 - v otherwise
+ *    - Φ = v for x < 0 and 1 - v otherwise
+ *    The direct lanes scale by exponential::Ldexp<>, which rounds subnormal
+ *    results once. The complemented ones only need v while it shows in the
+ *    sum, so 2^m is clamped to stay normal. Vectors without tail lanes
+ *    skip this step only under the default LargeArgument::kBranchy.
+ *
+ * Double errors peak by |z| = 1/2, where the polynomial hands over to the
+ * tail, ~0.85 ULP with kHighAccuracy and ~2.2 ULP without. Float with
+ * kHighAccuracy widens to the double kernel, so the result is rounded once,
+ * ~0.5 ULP error. The float low tier stays in float, ~2.2 ULP error.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V ErfKernel(V x) {
+  using namespace hn;
+  namespace data = ::npsr::erf::data;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  if constexpr (kIsSingle && Prec::kHighAccuracy) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, ErfKernel<OP, Prec>(PromoteLowerTo(dw, x)));
+    auto up = DemoteTo(dh, ErfKernel<OP, Prec>(PromoteUpperTo(dw, x)));
+    return Combine(d, up, lo);
+  } else {
+    const RebindToSigned<decltype(d)> di;
+    constexpr bool kHigh = Prec::kHighAccuracy;
+    constexpr int kMantBits = hwy::MantissaBits<T>();
+    const V one = Set(d, static_cast<T>(1.0));
+    const V half = Set(d, static_cast<T>(0.5));
+    const V sign_mask = Set(d, static_cast<T>(-0.0));
+
+    constexpr T kBound = OP == Operation::kNormCdf
+                             ? static_cast<T>(kErfcBound<T> * 1.4142135623730951)
+                             : kErfcBound<T>;
+    const V xc = Min(Max(x, Set(d, -kBound)), Set(d, kBound));
+    V z = xc;
+    V z_lo = Zero(d);
+    if constexpr (OP == Operation::kNormCdf) {
+      constexpr auto kC = data::kInvSqrt2<T>;
+      V p_lo;
+      z = TwoProd(xc, Set(d, kC[0]), p_lo);
+      z_lo = MulAdd(xc, Set(d, kC[1]), p_lo);
+    }
+
+    V w_lo;
+    V w = ErfPoly(z, w_lo);
+    V ret;
+    if constexpr (OP == Operation::kErf) {
+      ret = w;
+    } else {
+      if constexpr (OP == Operation::kNormCdf) {
+        // erf'(z) = 2/√π·e^(-z²) ≈ 2/√π·(1 - z²), z_lo being ~2^-digits·z
+        V deriv = Mul(Set(d, data::kTwoDivSqrtPi<T>), NegMulAdd(z, z, one));
+        w_lo = MulAdd(z_lo, deriv, w_lo);
+      } else {
+        w = Neg(w);
+        w_lo = Neg(w_lo);
+      }
+      V s = Add(one, w);
+      V err = Sub(w, Sub(s, one));
+      ret = Add(s, Add(err, w_lo));
+      if constexpr (OP == Operation::kNormCdf) {
+        ret = Mul(ret, half);
+      }
+    }
+
+    const V a = Abs(z);
+    const auto is_tail = Ge(a, Set(d, kErfPolyBound<T>));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_tail))) {
+      // NaN and small lanes are kept in range of the table
+      const V a_hi = IfThenElse(is_tail, a, half);
+      const V a_lo = Xor(z_lo, And(z, sign_mask));
+      VI m;
+      V v_lo;
+      V v = ErfcTail<kHigh>(a_hi, a_lo, m, v_lo);
+      if constexpr (OP == Operation::kNormCdf) {
+        m = Sub(m, Set(di, 1));
+      }
+      const V scale =
+          exponential::Pow2I(d, Max(m, Set(di, -2 * kMantBits)));
+      const V c = Set(d, static_cast<T>(OP == Operation::kErfc ? 2.0 : 1.0));
+      V v_hi = Mul(v, scale);
+      V s = Sub(c, v_hi);
+      V err = Sub(Sub(c, s), v_hi);
+      V tail = Add(s, NegMulAdd(v_lo, scale, err));
+      if constexpr (OP == Operation::kErf) {
+        tail = CopySign(tail, z);
+      } else {
+        const V zero = Zero(d);
+        const auto is_direct =
+            OP == Operation::kErfc ? Gt(z, zero) : Lt(z, zero);
+        tail = IfThenElse(is_direct, exponential::Ldexp(Add(v, v_lo), m),
+                          tail);
+      }
+      ret = IfThenElse(is_tail, tail, ret);
+    }
+    return ret;
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::erf
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_ERF_ERF_INL_H_
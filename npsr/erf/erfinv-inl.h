@@ -0,0 +1,233 @@
+#if defined(NPSR_ERF_ERFINV_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_ERF_ERFINV_INL_H_
+#undef NPSR_ERF_ERFINV_INL_H_
+#else
+#define NPSR_ERF_ERFINV_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/dw-inl.h"  // TwoProd
+#include "npsr/erf/data/data.h"
+#include "npsr/erf/erf-inl.h"  // ErfPoly, ErfcPoly, HornerLanes
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReduced, Ldexp
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // LogKernel
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::erf {
+
+/**
+ * This function computes erfinv(a) ≈ a·P(w), w = -log(1 - a²) ≥ 0, through
+ * one polynomial per octave of w, see npsr/erf/data/erfinv-inl.h.sol.
+ *
+ * The octave indexes the table by the exponent of w, [0, 1) sharing the
+ * first column, and P is taken in u = w - c, c the midpoint of the octave,
+ * which is exact as w and c share the binade.
+ */
+template <typename V>
+NPSR_INTRIN V ErfInvPoly(V a, V w) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using TU = hwy::MakeUnsigned<T>;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  using VU = Vec<decltype(du)>;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+  constexpr TU kCols = kIsSingle ? 8 : 16;
+  constexpr TU kBias = exponential::kExpBias<T>;
+  constexpr TU kExpMask = (kBias * 2 + 1) << kMantBits;
+
+  // w below 1 shares the first column, -0 and the NaN or ∞ of the poles
+  // are kept within the table
+  const V wa = Abs(w);
+  const VU bits = BitCast(du, wa);
+  const VU exp = ShiftRight<kMantBits>(bits);
+  const VU idx = Sub(Min(Max(exp, Set(du, kBias - 1)),
+                         Set(du, kBias + kCols - 2)),
+                     Set(du, kBias - 1));
+  const VU mid_bits =
+      Or(And(bits, Set(du, kExpMask)), Set(du, TU{1} << (kMantBits - 1)));
+  const V mid = IfThenElse(RebindMask(d, Eq(idx, Zero(du))),
+                           Set(d, static_cast<T>(0.5)), BitCast(d, mid_bits));
+  const V u = Sub(wa, mid);
+
+  V p;
+  if constexpr (kIsSingle) {
+    V c8, c7, c6, c5, c4, c3, c2, c1, c0;
+    kErfInvTableF32.Load(idx, c8, c7, c6, c5, c4, c3, c2, c1, c0);
+    p = HornerLanes(u, c8, c7, c6, c5, c4, c3, c2, c1, c0);
+  } else {
+    V c11, c10, c9, c8, c7, c6, c5, c4, c3, c2, c1, c0;
+    kErfInvTableF64.Load(idx, c11, c10, c9, c8, c7, c6, c5, c4, c3, c2, c1,
+                         c0);
+    p = HornerLanes(u, c11, c10, c9, c8, c7, c6, c5, c4, c3, c2, c1, c0);
+  }
+  return Mul(a, p);
+}
+
+/**
+ * This function refines x ≈ erfinv(a), a = a_hi + a_lo = 1 - t, by one
+ * Newton step on f(x) = erf(x) - a and returns the correction, so x + lo
+ * is a double-word.
+ *
+ * Both f and f'(x) = 2/√π·e^(-x²) carry the factor 2^m·e = e^(-x²), see
+ * exponential::Reduce<>, so the step is -R/(2/√π·e) with R = 2^-m·f:
+ * - Tail x ≥ 1/2: f = t - erfc(x) and R = t·2^-m - e·g(x), see ErfcPoly<>.
+ *   t is exact, the product is a double-word under kHigh and the
+ *   difference cancels exactly, so R keeps the accuracy of erfc.
+ * - Small x < 1/2: R = (erf(x) - a)·2^-m, erf(x) from ErfPoly<> as a
+ *   double-word.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V ErfInvNewton(V x, V a_hi, V a_lo, V t) {
+  using namespace hn;
+  using exponential::Operation;
+  namespace data = ::npsr::erf::data;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const V half = Set(d, static_cast<T>(0.5));
+
+  V s_lo;
+  V s_hi = TwoProd(x, x, s_lo);
+  V r_hi, r_lo;
+  VI k = exponential::Reduce<Operation::kExp, kHigh>(Neg(s_hi), r_hi, r_lo);
+  const V r = Add(r_hi, Sub(r_lo, s_lo));
+  VI m;
+  V e_hi, e_lo;
+  if constexpr (kHigh) {
+    e_hi = exponential::ExpReducedDW(k, r, m, e_lo);
+  } else {
+    e_hi = exponential::ExpReduced<false>(k, r, m);
+    e_lo = Zero(d);
+  }
+  // |x| < 28, so 2^-m stays below the overflow threshold and the scaling of
+  // t or of the small residual is exact
+  const VI neg_m = Neg(m);
+
+  // NaN and small lanes are kept in range of the table
+  const auto is_tail = Ge(x, half);
+  const V xt = Min(IfThenElse(is_tail, x, half), Set(d, kErfcBound<T>));
+  V g_lo;
+  V g_hi = ErfcPoly<kHigh>(xt, Zero(d), g_lo);
+  V p_lo;
+  V p_hi = TwoProd(e_hi, g_hi, p_lo);
+  p_lo = MulAdd(e_hi, g_lo, MulAdd(e_lo, g_hi, p_lo));
+  V resid = Sub(Sub(exponential::Ldexp(t, neg_m), p_hi), p_lo);
+
+  V w_lo;
+  V w = ErfPoly(IfThenElse(is_tail, half, x), w_lo);
+  V small = Add(Sub(w, a_hi), Sub(w_lo, a_lo));
+  resid = IfThenElse(is_tail, resid, exponential::Ldexp(small, neg_m));
+
+  const V deriv = Mul(Set(d, data::kTwoDivSqrtPi<T>), e_hi);
+  return Neg(Div(resid, deriv));
+}
+
+/**
+ * This function computes erfinv(x) or the standard normal quantile
+ * Φ⁻¹(x) = √2·erfinv(2x - 1), NaN aside, for |x| < 1 and 0 < x < 1.
+ *
+ * Algorithm Overview:
+ * 1. Tail distance: erfinv works on a = |x| and t = 1 - a. Φ⁻¹ folds x to
+ *    p = min(x, 1 - x), both exact, so t = 2p is exact down to subnormal p
+ *    and a = 1 - t carries its rounding error in a_lo.
+ *
+ * 2. Seed: w = -log(t·(2 - t)) = -log(1 - a²) through
+ *    logarithm::LogKernel<>, t·(2 - t) being scaled into the normal range
+ *    for subnormal p, then x0 = a·P(w), see ErfInvPoly<>. Taking 1 - a²
+ *    from t keeps the tails accurate where a rounds to 1. The scaling is
+ *    skipped for vectors without such lanes only under the default
+ *    LargeArgument::kBranchy.
+ *
+ * 3. Refinement: double takes one Newton step, see ErfInvNewton<>, whose
+ *    residual is as accurate as Erf/Erfc of the matching tier, ~0.85 ULP
+ *    error with kHighAccuracy and ~1.4 ULP (erfinv) or ~1.9 ULP (Φ⁻¹)
+ *    without, peaking where x0 crosses 1/2. Float with kHighAccuracy
+ *    widens to the 2^-35.9 double polynomial alone, which rounds once,
+ *    ~0.5 ULP error. The float low tier keeps the 2^-24.1 float
+ *    polynomial, ~2.2 ULP (erfinv) or ~3.2 ULP (Φ⁻¹) error.
+ *
+ * 4. Sign and scale: erfinv takes the sign of x, Φ⁻¹ is multiplied by √2
+ *    as a double-word and negated below x = 1/2.
+ *
+ * The poles and x outside the domain give unspecified finite or NaN
+ * results, which the caller replaces.
+ */
+template <Operation OP, typename Prec, bool kRefine = true, typename V>
+NPSR_INTRIN V ErfInvKernel(V x) {
+  using namespace hn;
+  namespace data = ::npsr::erf::data;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  if constexpr (kIsSingle && Prec::kHighAccuracy) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo =
+        DemoteTo(dh, ErfInvKernel<OP, Prec, false>(PromoteLowerTo(dw, x)));
+    auto up =
+        DemoteTo(dh, ErfInvKernel<OP, Prec, false>(PromoteUpperTo(dw, x)));
+    return Combine(d, up, lo);
+  } else {
+    const RebindToSigned<decltype(d)> di;
+    const V one = Set(d, static_cast<T>(1.0));
+    const V two = Set(d, static_cast<T>(2.0));
+
+    V a, t;
+    V a_lo = Zero(d);
+    if constexpr (OP == Operation::kErfInv) {
+      a = Abs(x);
+      t = Sub(one, a);
+    } else {
+      const V p = Min(x, Sub(one, x));
+      t = Add(p, p);
+      a = Sub(one, t);
+      a_lo = Sub(Sub(one, a), t);
+    }
+
+    V arg = Mul(t, Sub(two, t));
+    VI k_adj = Zero(di);
+    if constexpr (OP == Operation::kNormQuantile) {
+      const auto is_sub = Lt(arg, Set(d, std::numeric_limits<T>::min()));
+      if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_sub))) {
+        constexpr int kShift = hwy::MantissaBits<T>() + 1;
+        const V scale = Set(d, kIsSingle ? 0x1p24f : 0x1p53);
+        arg = IfThenElse(is_sub, Mul(arg, scale), arg);
+        k_adj = IfThenElseZero(RebindMask(di, is_sub), Set(di, -kShift));
+      }
+    }
+    const V w = Neg(logarithm::LogKernel<logarithm::Operation::kLog, false>(
+        arg, Zero(d), k_adj));
+    V ret = ErfInvPoly(a, w);
+    V lo = Zero(d);
+    if constexpr (kRefine && !kIsSingle) {
+      lo = ErfInvNewton<Prec::kHighAccuracy>(ret, a, a_lo, t);
+    }
+
+    if constexpr (OP == Operation::kErfInv) {
+      ret = CopySign(Add(ret, lo), x);
+    } else {
+      // √2 = 2/√2 keeps the split of data::kInvSqrt2 exact
+      constexpr auto kC = data::kInvSqrt2<T>;
+      const V c_hi = Set(d, 2 * kC[0]);
+      V p_lo;
+      V p_hi = TwoProd(ret, c_hi, p_lo);
+      ret = Add(p_hi, MulAdd(ret, Set(d, 2 * kC[1]), MulAdd(lo, c_hi, p_lo)));
+      ret = IfThenElse(Lt(x, Set(d, static_cast<T>(0.5))), Neg(ret), ret);
+    }
+    return ret;
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::erf
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_ERF_ERFINV_INL_H_
@@ -0,0 +1,10 @@
+// Aggregates the exponential data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Intentionally NOT guarded with #ifndef: it pulls in the Highway
+// target-toggled header exp2j-inl.h, which must be re-included once per SIMD
+// target, see npsr/trig/data/data.h. The include-once child (exp) carries its
+// own guard and no-ops on re-entry.
+#include "npsr/lut-inl.h"
+#include "npsr/exponential/data/exp.h"
+#include "npsr/exponential/data/exp2j-inl.h"
@@ -0,0 +1,54 @@
+// Auto-generated by npsr/exponential/data/exp.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_EXPONENTIAL_DATA_EXP_H
+#define NPSR_EXPONENTIAL_DATA_EXP_H
+
+namespace npsr::exponential::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kExpPoly[] = {};
+// exp degree 3, |r| ≤ ln2/64, relative error 2^-32.75
+template <> inline constexpr float kExpPoly<float>[] = {
+0x1.5555aep-3f, 0x1.00009cp-1f, };
+// exp degree 6, |r| ≤ ln2/64, relative error 2^-63.25
+template <> inline constexpr double kExpPoly<double>[] = {
+0x1.6c1293fa54a41p-10, 0x1.11115b739d495p-7, 0x1.55555556d8bbbp-5, 0x1.5555555548ff3p-3, 
+0x1.ffffffffffff8p-2, };
+
+template <typename T> inline constexpr char kExpLowPoly[] = {};
+// exp degree 6, |r| ≤ ln2/2, relative error 2^-27.375
+template <> inline constexpr float kExpLowPoly<float>[] = {
+0x1.5baaeap-10f, 0x1.124984p-7f, 0x1.556b44p-5f, 0x1.555478p-3f, 
+0x1.ffffe8p-2f, };
+// exp degree 11, |r| ≤ ln2/2, relative error 2^-56.75
+template <> inline constexpr double kExpLowPoly<double>[] = {
+0x1.afe56dd8f46p-26, 0x1.28b1866810c73p-22, 0x1.71dd994c9c285p-19, 0x1.a0199375ac5ep-16, 
+0x1.a01a01e0c91acp-13, 0x1.6c16c187fdbdep-10, 0x1.11111111052c6p-7, 0x1.555555554ebaep-5, 
+0x1.5555555555581p-3, 0x1.0000000000012p-1, };
+
+template <typename T> inline constexpr char kLn2[] = {};
+template <> inline constexpr float kLn2<float>[] = {
+0x1.63p-1f, -0x1.bd0106p-13f, };
+template <> inline constexpr double kLn2<double>[] = {
+0x1.62e42fefap-1, 0x1.cf79abc9e3b3ap-40, };
+
+template <typename T> inline constexpr char kLog10Of2[] = {};
+template <> inline constexpr float kLog10Of2<float>[] = {
+0x1.344p-2f, 0x1.3509f8p-18f, };
+template <> inline constexpr double kLog10Of2<double>[] = {
+0x1.34413509fp-2, 0x1.e7fbcc47c4acdp-40, };
+
+template <typename T> inline constexpr char kInvLn2 = '_';
+template <> inline constexpr float kInvLn2<float> = 0x1.715476p0f;
+template <> inline constexpr double kInvLn2<double> = 0x1.71547652b82fep0;
+
+template <typename T> inline constexpr char kLog2Of10 = '_';
+template <> inline constexpr float kLog2Of10<float> = 0x1.a934fp1f;
+template <> inline constexpr double kLog2Of10<double> = 0x1.a934f0979a371p1;
+
+template <typename T> inline constexpr char kLn10 = '_';
+template <> inline constexpr float kLn10<float> = 0x1.26bb1cp1f;
+template <> inline constexpr double kLn10<double> = 0x1.26bb1bbb55516p1;
+
+} // namespace npsr::exponential::data
+
+#endif // NPSR_EXPONENTIAL_DATA_EXP_H
@@ -0,0 +1,86 @@
+// Generates the minimax polynomials and constants of the exponential kernels
+// (see npsr/exponential/exp-inl.h).
+//
+// Every operation is reduced to base^x = 2^(k/N)·e^r, with N = 32 for the
+// table driven tier and N = 1 for the table-free one, so the polynomial has
+// to cover |r| ≤ ln2/(2N):
+//   e^r ≈ 1 + r + r²·P(r)
+// The leading terms are kept exact so expm1 can add them last. The range is
+// widened slightly to absorb the rounding of k.
+//
+// Parameters:
+//   pName - Name of the C++ array
+//   pT    - Type descriptor (Float32 or Float64)
+//   pDeg  - Degree of the polynomial
+//   pN    - Table size of the reduction
+procedure Exp_(pName, pT, pDeg, pN) {
+  var i, $;
+  $.bound = log(2) / (2 * pN) * (1 + 2^-12);
+  $.range = [-$.bound; $.bound];
+  $.monos = [||];
+  for i from 2 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.exp = MinimaxCoeffs(pT, exp(x), $.monos, $.range, 1 + x);
+  $.array = CArrayT(pT, $.exp.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// exp degree " @ pDeg @ ", |r| ≤ ln2/" @ 2 * pN @
+    ", relative error 2^" @ round(log2($.exp.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " " @ pName @ "<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kExpPoly[] = {};"
+);
+Append @ Exp_("kExpPoly", Float32, 3, 32);
+Append @ Exp_("kExpPoly", Float64, 6, 32);
+Append(
+  "",
+  "template <typename T> inline constexpr char kExpLowPoly[] = {};"
+);
+Append @ Exp_("kExpLowPoly", Float32, 6, 1);
+Append @ Exp_("kExpLowPoly", Float64, 11, 1);
+
+// Cody-Waite pairs of the reduction r = x - k·C/N. The heads leave room for
+// the largest |k| of the clamped input, 2^13 (float) and 2^16 (double) with
+// N = 32, so k·C₁/N is exact, and dividing by N is exact as well.
+Append(
+  "",
+  "template <typename T> inline constexpr char kLn2[] = {};",
+  "template <> inline constexpr float kLn2<float>[] = " @
+  CArrayT(Float32, Constants(log(2), [|RN, 11, 24|]), 4) @ ";",
+  "template <> inline constexpr double kLn2<double>[] = " @
+  CArrayT(Float64, Constants(log(2), [|RN, 37, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kLog10Of2[] = {};",
+  "template <> inline constexpr float kLog10Of2<float>[] = " @
+  CArrayT(Float32, Constants(log10(2), [|RN, 11, 24|]), 4) @ ";",
+  "template <> inline constexpr double kLog10Of2<double>[] = " @
+  CArrayT(Float64, Constants(log10(2), [|RN, 37, 53|]), 4) @ ";",
+  "",
+
+  "template <typename T> inline constexpr char kInvLn2 = '_';",
+  "template <> inline constexpr float kInvLn2<float> = " @ single(1/log(2)) @ "f;",
+  "template <> inline constexpr double kInvLn2<double> = " @ double(1/log(2)) @ ";",
+  "",
+
+  "template <typename T> inline constexpr char kLog2Of10 = '_';",
+  "template <> inline constexpr float kLog2Of10<float> = " @ single(log2(10)) @ "f;",
+  "template <> inline constexpr double kLog2Of10<double> = " @ double(log2(10)) @ ";",
+  "",
+
+  "template <typename T> inline constexpr char kLn10 = '_';",
+  "template <> inline constexpr float kLn10<float> = " @ single(log(10)) @ "f;",
+  "template <> inline constexpr double kLn10<double> = " @ double(log(10)) @ ";",
+  ""
+);
+
+WriteCPPHeader("npsr::exponential::data");
@@ -0,0 +1,41 @@
+// Generates the lookup table of the exponential kernels
+// (see npsr/exponential/exp-inl.h).
+//
+// The reduction writes base^x = 2^m · 2^(j/32) · e^r with 0 ≤ j < 32, the
+// kernel loads 2^(j/32) as a high part and the rounding error of it, so the
+// product with e^r keeps ~2·digits of the table value.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pLow - false for the high parts, true for the low parts
+procedure Exp2Table_(pT, pLow) {
+  var r, j, $;
+  r = [||];
+  for j from 0 to 31 do {
+    $.exact = 2^(j / 32);
+    $.hi = pT.kRound($.exact);
+    if (pLow) then {
+      r = r :. pT.kRound($.exact - $.hi);
+    } else {
+      r = r :. $.hi;
+    };
+  };
+  return CArrayT(pT, r, 4);
+};
+
+Append(
+  "inline constexpr auto kExp2TableF32 = MakeLut<float>(",
+  "// High parts of 2^(j/32)",
+  Exp2Table_(Float32, false) @ ",",
+  "// Low parts of 2^(j/32)",
+  Exp2Table_(Float32, true),
+  ");",
+  "inline constexpr auto kExp2TableF64 = MakeLut<double>(",
+  "// High parts of 2^(j/32)",
+  Exp2Table_(Float64, false) @ ",",
+  "// Low parts of 2^(j/32)",
+  Exp2Table_(Float64, true),
+  ");"
+);
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::exponential");
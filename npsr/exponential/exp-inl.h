@@ -0,0 +1,288 @@
+#if defined(NPSR_EXPONENTIAL_EXP_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_EXPONENTIAL_EXP_INL_H_
+#undef NPSR_EXPONENTIAL_EXP_INL_H_
+#else
+#define NPSR_EXPONENTIAL_EXP_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoSum
+#include "npsr/exponential/data/data.h"
+#include "npsr/hwy.h"
+#include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::exponential {
+
+// Operation type of the exponential kernels
+enum class Operation { kExp = 0, kExp2 = 1, kExp10 = 2, kExpm1 = 3 };
+
+// log2 of the size of the 2^(j/N) table, see
+// npsr/exponential/data/exp2j-inl.h.sol
+constexpr int kTableBits = 5;
+
+// Exponent bias of T, 127 for float and 1023 for double
+template <typename T>
+constexpr int kExpBias = (1 << (hwy::ExponentBits<T>() - 1)) - 1;
+
+/**
+ * This function reduces base^x = 2^(k/N)·e^r, N = 2^kTableBits when kTable
+ * is set and 1 otherwise, |r| ≤ ln2/(2N).
+ *
+ * - exp, expm1: k = round(x·N/ln2), r = x - k·ln2/N by Cody-Waite, r_lo
+ *   carries the rounding of the second product
+ * - exp2: k = round(x·N), x - k/N is exact and only scaling it by ln2
+ *   rounds
+ * - exp10: k = round(x·N·log2(10)), r = (x - k·log10(2)/N)·ln10
+ *
+ * Each Cody-Waite head leaves room for the largest |k| of the clamped
+ * input, so k·C₁/N never rounds. Returns k as an integer.
+ */
+template <Operation OP, bool kTable, typename V>
+NPSR_INTRIN auto Reduce(V x, V &r_hi, V &r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::exponential::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  constexpr T kN = kTable ? static_cast<T>(1 << kTableBits) : T(1);
+
+  constexpr T kScale = OP == Operation::kExp2    ? kN
+                       : OP == Operation::kExp10 ? kN * data::kLog2Of10<T>
+                                                 : kN * data::kInvLn2<T>;
+  const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
+  V k_biased = MulAdd(x, Set(d, kScale), magic_round);
+  V k = Sub(k_biased, magic_round);
+
+  if constexpr (OP == Operation::kExp2) {
+    V t = NegMulAdd(k, Set(d, T(1) / kN), x);
+    r_hi = Mul(t, Set(d, data::kLn2<T>[0]));
+    r_lo = Mul(t, Set(d, data::kLn2<T>[1]));
+  } else if constexpr (OP == Operation::kExp10) {
+    constexpr auto kC = data::kLog10Of2<T>;
+    V t = NegMulAdd(k, Set(d, kC[0] / kN), x);
+    t = NegMulAdd(k, Set(d, kC[1] / kN), t);
+    // |r| ≤ ln2/(2N) keeps the rounding of the product far below the ULP
+    r_hi = Mul(t, Set(d, data::kLn10<T>));
+    r_lo = Zero(d);
+  } else {
+    constexpr auto kC = data::kLn2<T>;
+    r_hi = NegMulAdd(k, Set(d, kC[0] / kN), x);
+    r_lo = Mul(k, Set(d, -kC[1] / kN));
+  }
+  return Sub(BitCast(di, k_biased), BitCast(di, magic_round));
+}
+
+/// 2^m for m within the normal exponent range
+template <typename D, typename VI>
+NPSR_INTRIN VFromD<D> Pow2I(D d, VI m) {
+  using namespace hn;
+  using T = TFromD<D>;
+  const RebindToSigned<D> di;
+  return BitCast(d, ShiftLeft<hwy::MantissaBits<T>()>(
+                        Add(m, Set(di, kExpBias<T>))));
+}
+
+/// y·2^m by adding m to the exponent field, the result must stay normal
+template <typename V, typename VI>
+NPSR_INTRIN V LdexpFast(V y, VI m) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  return BitCast(d, Add(BitCast(di, y),
+                        ShiftLeft<hwy::MantissaBits<T>()>(m)));
+}
+
+/**
+ * y·2^m for y ∈ [0.5, 4) and |m| up to twice the exponent bias.
+ *
+ * Splits the scale into two normal powers of two, so the first product is
+ * exact and only the second one rounds, into ±∞ on overflow or a correctly
+ * rounded subnormal on underflow.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V Ldexp(V y, VI m) {
+  using namespace hn;
+  const DFromV<V> d;
+  VI m1 = ShiftRight<1>(m);
+  VI m2 = Sub(m, m1);
+  return Mul(Mul(y, Pow2I(d, m1)), Pow2I(d, m2));
+}
+
+/**
+ * y·2^m for y ∈ [0.5, 4) under flush to zero. The exponent of the result is
+ * resolved by integer arithmetic, results below the normal range become zero
+ * and above it infinity, so no subnormal is ever produced.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V LdexpFTZ(V y, VI m) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  VI e = Add(BitCast(di, GetBiasedExponent(y)), m);
+  V ret = IfThenElseZero(RebindMask(d, Gt(e, Zero(di))), LdexpFast(y, m));
+  return IfThenElse(RebindMask(d, Gt(e, Set(di, 2 * kExpBias<T>))), Inf(d),
+                    ret);
+}
+
+/**
+ * This function computes 2^(k/N)·e^r as 2^m·y, y ∈ [0.99, 2.02), for k and
+ * r from Reduce<>. Callers carrying a low part of the argument, such as pow,
+ * add it to r first.
+ *
+ * 1. Table Lookup: with kTable, k = 32·m + j and 2^(j/32) is loaded as
+ *    high and low parts t_hi + t_lo
+ *
+ * 2. Polynomial Approximation: e^r ≈ 1 + q, q = r + r²·P(r), a minimax
+ *    polynomial generated by npsr/exponential/data/exp.h.sol
+ *
+ * 3. Reconstruction: y = t_hi + (t_hi·q + t_lo), which rounds once on top of
+ *    terms ~2^-6 smaller, ~0.55 ULP error. Without the table, y = 1 + q over
+ *    |r| ≤ ln2/2 with a longer polynomial, ~1-1.3 ULP error and no lookup.
+ */
+template <bool kTable, typename V, typename VI>
+NPSR_INTRIN V ExpReduced(VI k, V r, VI &m) {
+  using namespace hn;
+  namespace data = ::npsr::exponential::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  V r2 = Mul(r, r);
+  if constexpr (kTable) {
+    V q = MulAdd(r2, Poly(r, data::kExpPoly<T>), r);
+    V t_hi, t_lo;
+    VI j = And(k, Set(DFromV<VI>(), (1 << kTableBits) - 1));
+    if constexpr (kIsSingle) {
+      kExp2TableF32.Load(BitCast(du, j), t_hi, t_lo);
+    } else {
+      kExp2TableF64.Load(BitCast(du, j), t_hi, t_lo);
+    }
+    m = ShiftRight<kTableBits>(k);
+    return Add(t_hi, MulAdd(t_hi, q, t_lo));
+  } else {
+    V q = MulAdd(r2, Poly(r, data::kExpLowPoly<T>), r);
+    m = k;
+    return Add(Set(d, static_cast<T>(1.0)), q);
+  }
+}
+
+/**
+ * Table driven ExpReduced<> that keeps y as a double-word hi + lo. The sum
+ * t_hi + (t_hi·q + t_lo) is left unrounded, so y is accurate to ~2^-6 ULP
+ * and callers combining e^x with other terms, such as sinh and tanh, round
+ * only once.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V ExpReducedDW(VI k, V r, VI &m, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::exponential::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  V q = MulAdd(Mul(r, r), Poly(r, data::kExpPoly<T>), r);
+  V t_hi, t_lo;
+  VI j = And(k, Set(DFromV<VI>(), (1 << kTableBits) - 1));
+  if constexpr (kIsSingle) {
+    kExp2TableF32.Load(BitCast(du, j), t_hi, t_lo);
+  } else {
+    kExp2TableF64.Load(BitCast(du, j), t_hi, t_lo);
+  }
+  m = ShiftRight<kTableBits>(k);
+  V tail = MulAdd(t_hi, q, t_lo);
+  V hi = Add(t_hi, tail);
+  lo = Sub(tail, Sub(hi, t_hi));
+  return hi;
+}
+
+/**
+ * This function computes e^x, 2^x or 10^x as 2^m·y, see Reduce<> and
+ * ExpReduced<>. The caller scales by 2^m, which is where overflow and
+ * underflow happen.
+ */
+template <Operation OP, bool kTable, typename V, typename VI>
+NPSR_INTRIN V ExpKernel(V x, VI &m) {
+  V r_hi, r_lo;
+  VI k = Reduce<OP, kTable>(x, r_hi, r_lo);
+  return ExpReduced<kTable>(k, hn::Add(r_hi, r_lo), m);
+}
+
+/**
+ * This function computes e^x - 1 for x within the clamped range, assuming
+ * 2^m stays normal. y and m are also returned for the caller to redo lanes
+ * close to overflow as 2^m·y.
+ *
+ * Same reduction and polynomial as ExpKernel<> followed by 2^m·y - 1:
+ * - With kTable, y = t·(1 + q) is kept as y_hi + y_lo, the product
+ *   t_hi·r_hi split exactly by FMA when the target fuses it. 2^m·y_hi - 1 is
+ *   then an exact two-sum, so the cancellation around x ≈ 0 keeps every bit
+ *   of r and the result rounds once. The polynomial error relative to e^r
+ *   grows by 1/|x| for k = 0, ~0.8 ULP error with native FMA and ~1.1 ULP
+ *   without.
+ * - Otherwise the result is 2^m·q + (2^m - 1), ~2 ULP error.
+ */
+template <bool kTable, typename V, typename VI>
+NPSR_INTRIN V Expm1Kernel(V x, V &y, VI &m) {
+  using namespace hn;
+  namespace data = ::npsr::exponential::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  V r_hi, r_lo;
+  VI k = Reduce<Operation::kExpm1, kTable>(x, r_hi, r_lo);
+  V r = Add(r_hi, r_lo);
+  V r2 = Mul(r, r);
+  if constexpr (kTable) {
+    // e^r - 1 = r_hi + q_lo
+    V q_lo = MulAdd(r2, Poly(r, data::kExpPoly<T>), r_lo);
+    V t_hi, t_lo;
+    VI j = And(k, Set(DFromV<VI>(), (1 << kTableBits) - 1));
+    if constexpr (kIsSingle) {
+      kExp2TableF32.Load(BitCast(du, j), t_hi, t_lo);
+    } else {
+      kExp2TableF64.Load(BitCast(du, j), t_hi, t_lo);
+    }
+    m = ShiftRight<kTableBits>(k);
+
+    // t·(1 + q) ≈ t_hi + t_hi·r_hi + (t_hi·q_lo + t_lo·(1 + r_hi)), where
+    // |t_hi·r_hi| < t_hi. t_lo·r_hi is kept since the result may be as small
+    // as r itself
+    V a_hi = Mul(t_hi, r_hi);
+    V a_lo = kNativeFMA ? MulSub(t_hi, r_hi, a_hi) : Zero(d);
+    V y_hi = Add(t_hi, a_hi);
+    V y_lo = Add(Sub(t_hi, y_hi), a_hi);
+    V tail = MulAdd(t_hi, q_lo, MulAdd(t_lo, r_hi, t_lo));
+    y_lo = Add(y_lo, Add(a_lo, tail));
+
+    // 2^m·y_hi is exact, two-sum of it with -1
+    V scale = Pow2I(d, m);
+    V h = Mul(scale, y_hi);
+    V err;
+    V sum = TwoSum(h, Neg(one), err);
+    y = Add(y_hi, y_lo);
+    return Add(sum, MulAdd(scale, y_lo, err));
+  } else {
+    V q = MulAdd(r2, Poly(r, data::kExpLowPoly<T>), r);
+    m = k;
+    V scale = Pow2I(d, m);
+    y = Add(one, q);
+    return MulAdd(scale, q, Sub(scale, one));
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::exponential
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_EXPONENTIAL_EXP_INL_H_
@@ -0,0 +1,255 @@
+// Exponential function dispatcher for Highway SIMD library
+// This file provides the public API for e^x, 2^x, 10^x and e^x - 1 with
+// configurable precision, special case handling and subnormal mode
+//
+// Each function selects between two tiers of its kernel:
+// 1. Low precision: ~1-2 ULP error, polynomial over |r| ≤ ln2/2, no lookup
+// 2. High precision: < 1 ULP error, 2^(j/32) table with a short polynomial
+
+#if defined(NPSR_EXPONENTIAL_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_EXPONENTIAL_INL_H_
+#undef NPSR_EXPONENTIAL_INL_H_
+#else
+#define NPSR_EXPONENTIAL_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/exponential/exp-inl.h"  // Table driven exponential kernels
+#include "npsr/hwy.h"
+#include "npsr/precise.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::exponential {
+
+/**
+ * Bounds of the input under kSpecialCases. Past them the result already
+ * rounds to +∞, 0 or -1 (expm1), and the clamped input keeps k within the
+ * Cody-Waite heads and 2^m within what Ldexp<> can split.
+ */
+template <Operation OP, typename T>
+inline constexpr char kInputBound[] = {};
+template <>
+inline constexpr float kInputBound<Operation::kExp, float>[] = {-104.0f,
+                                                                89.0f};
+template <>
+inline constexpr double kInputBound<Operation::kExp, double>[] = {-746.0,
+                                                                  710.0};
+template <>
+inline constexpr float kInputBound<Operation::kExp2, float>[] = {-151.0f,
+                                                                 129.0f};
+template <>
+inline constexpr double kInputBound<Operation::kExp2, double>[] = {-1076.0,
+                                                                   1025.0};
+template <>
+inline constexpr float kInputBound<Operation::kExp10, float>[] = {-46.0f,
+                                                                  39.0f};
+template <>
+inline constexpr double kInputBound<Operation::kExp10, double>[] = {-324.0,
+                                                                    309.0};
+template <>
+inline constexpr float kInputBound<Operation::kExpm1, float>[] = {-18.0f,
+                                                                  89.0f};
+template <>
+inline constexpr double kInputBound<Operation::kExpm1, double>[] = {-40.0,
+                                                                    710.0};
+
+/**
+ * @brief Unified exponential implementation
+ *
+ * @tparam OP       Operation type: kExp, kExp2, kExp10 or kExpm1
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * The kernels scale by 2^m with a single integer add, which is only valid
+ * while the result stays normal. With kSpecialCases:
+ * - The input is clamped to kInputBound<>, ±∞ included, and NaN propagates.
+ * - Lanes whose 2^m may leave the normal range are redone with Ldexp<>,
+ *   giving ±∞ on overflow and correctly scaled subnormals, or with
+ *   LdexpFTZ<> under Subnormal::kFTZ, which flushes them to zero without
+ *   ever producing a subnormal. The LargeArgument branch policy decides
+ *   whether this is skipped for vectors without such lanes.
+ * - Overflow and underflow are raised for finite inputs unless
+ *   kNoExceptions.
+ * With kNoSpecialCases, inputs must give normal results, others are
+ * unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V Exponential(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  (void)prec;
+
+  V xc = x;
+  if constexpr (Prec::kSpecialCases) {
+    constexpr auto kBound = kInputBound<OP, T>;
+    xc = Min(Max(x, Set(d, kBound[0])), Set(d, kBound[1]));
+  }
+  V y, ret;
+  VI m;
+  if constexpr (OP == Operation::kExpm1) {
+    ret = Expm1Kernel<Prec::kHighAccuracy>(xc, y, m);
+  } else {
+    y = ExpKernel<OP, Prec::kHighAccuracy>(xc, m);
+    ret = LdexpFast(y, m);
+  }
+
+  if constexpr (Prec::kSpecialCases) {
+    // expm1 never underflows below -1, only its overflow side needs care
+    const VI limit = Set(di, kExpBias<T> - 2);
+    const auto is_edge = RebindMask(
+        d, OP == Operation::kExpm1 ? Gt(m, limit) : Gt(Abs(m), limit));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_edge))) {
+      V edge;
+      if constexpr (Prec::kFTZ) {
+        edge = LdexpFTZ(y, m);
+      } else {
+        edge = Ldexp(y, m);
+      }
+      if constexpr (OP == Operation::kExpm1) {
+        edge = Sub(edge, Set(d, static_cast<T>(1.0)));
+      }
+      ret = IfThenElse(is_edge, edge, ret);
+      if constexpr (Prec::kExceptions) {
+        const auto is_finite = IsFinite(x);
+        const auto is_tiny = Lt(ret, Set(d, std::numeric_limits<T>::min()));
+        int flags = !AllFalse(d, And(is_finite, IsInf(ret)))
+                        ? FPExceptions::kOverflow
+                        : 0;
+        if constexpr (OP != Operation::kExpm1) {
+          flags |= !AllFalse(d, And(is_finite, is_tiny))
+                       ? FPExceptions::kUnderflow
+                       : 0;
+        }
+        prec.Raise(flags);
+      }
+    }
+    ret = IfThenElse(IsNaN(x), x, ret);
+    if constexpr (OP == Operation::kExpm1) {
+      // Keeps expm1(-0) = -0
+      ret = IfThenElse(Eq(x, Zero(d)), x, ret);
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Applies Exponential over a contiguous array.
+ *
+ * The remainder is handled with a partial load/store, whose zero padding
+ * never raises.
+ */
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void ExponentialArray(Prec &prec, const T *in, size_t count,
+                                  T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Exponential<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(Exponential<OP>(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::exponential
+
+// Public API in the main npsr namespace
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Compute e^x of vector elements with configurable precision
+ *
+ * Reduces against a table of 2^(j/32) loaded through Lut, then evaluates a
+ * short minimax polynomial. Error: ~0.55 ULP by default, ~1-1.3 ULP with
+ * kLowAccuracy, which drops the table lookup for a longer polynomial.
+ * Subnormal results may round twice, ~0.75 ULP.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       e^x for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoSpecialCases};
+ * auto result = Exp(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Exp(Prec &prec, V x) {
+  return exponential::Exponential<exponential::Operation::kExp>(prec, x);
+}
+
+/// Compute 2^x of vector elements, same kernel and error bounds as Exp.
+template <typename Prec, typename V>
+NPSR_INTRIN V Exp2(Prec &prec, V x) {
+  return exponential::Exponential<exponential::Operation::kExp2>(prec, x);
+}
+
+/// Compute 10^x of vector elements, same kernel and error bounds as Exp.
+template <typename Prec, typename V>
+NPSR_INTRIN V Exp10(Prec &prec, V x) {
+  return exponential::Exponential<exponential::Operation::kExp10>(prec, x);
+}
+
+/**
+ * @brief Compute e^x - 1 of vector elements with configurable precision
+ *
+ * Accurate for tiny x, where e^x - 1 would cancel. Error: ~0.8 ULP by
+ * default (~1.1 ULP without native FMA), ~2 ULP with kLowAccuracy.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Expm1(Prec &prec, V x) {
+  return exponential::Exponential<exponential::Operation::kExpm1>(prec, x);
+}
+
+/**
+ * @brief Compute e^x over an array with configurable precision
+ *
+ * @param prec   Precise object managing FP environment
+ * @param in     Input array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be in itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Exp(Prec &prec, const T *in, size_t count, T *out) {
+  exponential::ExponentialArray<exponential::Operation::kExp>(prec, in, count,
+                                                              out);
+}
+
+/// Compute 2^x over an array, see the array overload of Exp.
+template <typename Prec, typename T>
+NPSR_INTRIN void Exp2(Prec &prec, const T *in, size_t count, T *out) {
+  exponential::ExponentialArray<exponential::Operation::kExp2>(prec, in,
+                                                               count, out);
+}
+
+/// Compute 10^x over an array, see the array overload of Exp.
+template <typename Prec, typename T>
+NPSR_INTRIN void Exp10(Prec &prec, const T *in, size_t count, T *out) {
+  exponential::ExponentialArray<exponential::Operation::kExp10>(prec, in,
+                                                                count, out);
+}
+
+/// Compute e^x - 1 over an array, see the array overload of Exp.
+template <typename Prec, typename T>
+NPSR_INTRIN void Expm1(Prec &prec, const T *in, size_t count, T *out) {
+  exponential::ExponentialArray<exponential::Operation::kExpm1>(prec, in,
+                                                                count, out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_EXPONENTIAL_INL_H_
@@ -0,0 +1,11 @@
+// Aggregates the gamma data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// There is no target-toggled table here either, the exponential and
+// logarithm tables come in through their kernels, so the guard is safe.
+#ifndef NPSR_GAMMA_DATA_DATA_H
+#define NPSR_GAMMA_DATA_DATA_H
+
+#include "npsr/gamma/data/gamma.h"
+
+#endif  // NPSR_GAMMA_DATA_DATA_H
@@ -0,0 +1,55 @@
+// Auto-generated by npsr/gamma/data/gamma.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_GAMMA_DATA_GAMMA_H
+#define NPSR_GAMMA_DATA_GAMMA_H
+
+namespace npsr::gamma::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kLGammaPoly[] = {};
+// lgamma(2 + t) degree 9, |t| ≤ 1/2, relative error 2^-26.75
+template <> inline constexpr float kLGammaPoly<float>[] = {
+-0x1.035da2p-12f, 0x1.2741f2p-11f, -0x1.37a8dep-10f, 0x1.79beb8p-9f, 
+-0x1.e40842p-8f, 0x1.5133fap-6f, -0x1.13e002p-4f, };
+// lgamma(2 + t) degree 19, |t| ≤ 1/2, relative error 2^-54.75
+template <> inline constexpr double kLGammaPoly<double>[] = {
+-0x1.17d0781c44b2ep-23, 0x1.2703c6effc4ebp-22, -0x1.d295ec4df68fp-22, 0x1.f038cb2f6a913p-21, 
+-0x1.1235bb6eb9201p-19, 0x1.2620de1c78d97p-18, -0x1.3cb7b3b3125e1p-17, 0x1.5808af19fa483p-16, 
+-0x1.78de7721ff5ap-15, 0x1.a127cd91ac95bp-14, -0x1.d3fd4c217341ep-13, 0x1.0b36af5972ed1p-11, 
+-0x1.38ac5c2c3ba16p-10, 0x1.7add6eadfcc7bp-9, -0x1.e404fc218f37p-8, 0x1.51322ac7d8333p-6, 
+-0x1.13e001a557607p-4, };
+
+// t² coefficient of the fits above, kept apart to be multiplied exactly
+template <typename T> inline constexpr char kLGammaC2 = '_';
+template <> inline constexpr float kLGammaC2<float> = 0x1.4a34ccp-2f;
+template <> inline constexpr double kLGammaC2<double> = 0x1.4a34cc4a60fa6p-2;
+
+template <typename T> inline constexpr char kStirlingPoly[] = {};
+// Stirling correction degree 2 in 1/x², x ≥ 8, relative error 2^-25
+template <> inline constexpr float kStirlingPoly<float>[] = {
+0x1.aa1e34p-11f, -0x1.6c28bcp-9f, 0x1.555556p-4f, };
+// Stirling correction degree 5 in 1/x², x ≥ 8, relative error 2^-51
+template <> inline constexpr double kStirlingPoly<double>[] = {
+-0x1.b1d60cf7014a5p-10, 0x1.b70794f557771p-11, -0x1.380ef12c7e4f9p-11, 0x1.a019fd8b028d6p-11, 
+-0x1.6c16c16bc4d6dp-9, 0x1.5555555555554p-4, };
+
+template <typename T> inline constexpr char kLGammaC1[] = {};
+template <> inline constexpr float kLGammaC1<float>[] = {
+0x1.b0ee6p-2f, 0x1.c824f4p-28f, };
+template <> inline constexpr double kLGammaC1<double>[] = {
+0x1.b0ee6072093cep-2, 0x1.6cb90701fbfabp-58, };
+
+template <typename T> inline constexpr char kStirlingC0[] = {};
+template <> inline constexpr float kStirlingC0<float>[] = {
+0x1.acfe3ap-2f, -0x1.e6d052p-27f, };
+template <> inline constexpr double kStirlingC0<double>[] = {
+0x1.acfe390c97d69p-2, 0x1.3494bc9001442p-56, };
+
+template <typename T> inline constexpr char kLnPi[] = {};
+template <> inline constexpr float kLnPi<float>[] = {
+0x1.250d04p0f, 0x1.1cf438p-25f, };
+template <> inline constexpr double kLnPi<double>[] = {
+0x1.250d048e7a1bdp0, 0x1.7abf2ad8d5088p-57, };
+
+} // namespace npsr::gamma::data
+
+#endif // NPSR_GAMMA_DATA_GAMMA_H
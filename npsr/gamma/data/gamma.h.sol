@@ -0,0 +1,134 @@
+// Generates the minimax polynomials of the gamma function kernels
+// (see npsr/gamma/gamma-inl.h).
+//
+// Central interval: the kernel reduces a to t = a - round(a), |t| ≤ 1/2,
+// and evaluates lgamma(2 + t), which vanishes at t = 0, so it is fitted as
+//   lgamma(2 + t) ≈ t·(c1 + t·(c2 + t·P(t))),  c1 = 1 - γ
+// with c1 kept as hi + lo and c2 emitted apart from P, for the kernel to
+// multiply the two leading terms exactly. Sollya has no gamma function, so
+// lgamma(2 + t) is given by its Taylor series
+//   lgamma(2 + t) = (1 - γ)·t + Σ (-1)^k·(ζ(k) - 1)/k·t^k,  k ≥ 2
+// whose coefficients come from mpmath through PyEval. The series converges
+// for |t| < 2, so 100 terms are exact far past the working precision.
+//
+// Large arguments: Stirling's series
+//   lgamma(x) = (x - 1/2)·log(x) - x + log(2π)/2 + S(1/x²)/x
+// with S fitted over x ≥ 8 against its asymptotic expansion
+//   S(z) = Σ B(2k)/(2k·(2k - 1))·z^(k - 1)
+// truncated at 21 terms, whose remainder is below 2^-70 there.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Degree of lgamma(2 + t), P having pDeg - 3, or of S
+//   pC1  - 1 - γ as hi + lo in the precision of pT
+// LGamma_ returns the lines of P and c2 apart, as .lines and .c2
+procedure LGamma_(pT, pDeg, pC1) {
+  var i, $;
+  $.range = [-1/2; 1/2];
+  $.series = parse(PyEval(
+    "import mpmath as mp",
+    "mp.mp.prec = 256",
+    "c = [1 - mp.euler]",
+    "c += [(-1)**k * (mp.zeta(k) - 1) / k for k in range(2, 100)]",
+    "print(' + '.join(f'({mp.nstr(v, 70)})*x^{i}' for i, v in enumerate(c)))"
+  ));
+  $.monos = [||];
+  for i from 1 to pDeg - 1 do {
+    $.monos = $.monos :. i;
+  };
+  // the series of lgamma(2 + t)/t, so the relative error holds at t = 0
+  $.p = MinimaxCoeffs(pT, $.series, $.monos, $.range, pC1[0] + pC1[1]);
+  // the last coefficient, of t¹ in lgamma(2 + t)/t, is c2
+  $.rev = revert($.p.coeffs);
+  $.array = CArrayT(pT, revert(tail($.rev)), 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// lgamma(2 + t) degree " @ pDeg @ ", |t| ≤ 1/2" @
+    ", relative error 2^" @ round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kLGammaPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  $.c2 = "template <> inline constexpr " @ pT.kCName @ " kLGammaC2<" @
+         pT.kCName @ "> = " @ head($.rev) @ pT.kCSFX @ ";";
+  return { .lines = $.lines, .c2 = $.c2 };
+};
+
+procedure Stirling_(pT, pDeg) {
+  var i, $;
+  $.range = [0; 1/64];
+  $.series = parse(PyEval(
+    "import mpmath as mp",
+    "mp.mp.prec = 256",
+    "c = [mp.bernoulli(2 * k) / (2 * k * (2 * k - 1)) for k in range(1, 22)]",
+    "print(' + '.join(f'({mp.nstr(v, 70)})*x^{i}' for i, v in enumerate(c)))"
+  ));
+  $.monos = [||];
+  for i from 0 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.p = MinimaxCoeffs(pT, $.series, $.monos, $.range, 0);
+  $.array = CArrayT(pT, $.p.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// Stirling correction degree " @ pDeg @ " in 1/x², x ≥ 8" @
+    ", relative error 2^" @ round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kStirlingPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+// Euler's constant γ, which Sollya doesn't provide
+EULER = 0.57721566490153286060651209008240243104215933593992;
+C1F32 = Constants(1 - EULER, [|RN, 24, 24|]);
+C1F64 = Constants(1 - EULER, [|RN, 53, 53|]);
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kLGammaPoly[] = {};"
+);
+LGF32 = LGamma_(Float32, 9, C1F32);
+LGF64 = LGamma_(Float64, 19, C1F64);
+Append @ LGF32.lines;
+Append @ LGF64.lines;
+Append(
+  "",
+  "// t² coefficient of the fits above, kept apart to be multiplied exactly",
+  "template <typename T> inline constexpr char kLGammaC2 = '_';",
+  LGF32.c2,
+  LGF64.c2,
+  "",
+  "template <typename T> inline constexpr char kStirlingPoly[] = {};"
+);
+Append @ Stirling_(Float32, 2);
+Append @ Stirling_(Float64, 5);
+Append(
+  "",
+  // 1 - γ as hi + lo, the slope of lgamma at 2
+  "template <typename T> inline constexpr char kLGammaC1[] = {};",
+  "template <> inline constexpr float kLGammaC1<float>[] = " @
+  CArrayT(Float32, C1F32, 4) @ ";",
+  "template <> inline constexpr double kLGammaC1<double>[] = " @
+  CArrayT(Float64, C1F64, 4) @ ";",
+  "",
+  // log(2π)/2 - 1/2 as hi + lo, the constant of Stirling's series
+  "template <typename T> inline constexpr char kStirlingC0[] = {};",
+  "template <> inline constexpr float kStirlingC0<float>[] = " @
+  CArrayT(Float32, Constants(log(2 * pi) / 2 - 1/2, [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kStirlingC0<double>[] = " @
+  CArrayT(Float64, Constants(log(2 * pi) / 2 - 1/2, [|RN, 53, 53|]), 4) @ ";",
+  "",
+  // log(π) as hi + lo, for the reflection formula
+  "template <typename T> inline constexpr char kLnPi[] = {};",
+  "template <> inline constexpr float kLnPi<float>[] = " @
+  CArrayT(Float32, Constants(log(pi), [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kLnPi<double>[] = " @
+  CArrayT(Float64, Constants(log(pi), [|RN, 53, 53|]), 4) @ ";",
+  ""
+);
+
+WriteCPPHeader("npsr::gamma::data");
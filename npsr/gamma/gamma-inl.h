@@ -0,0 +1,418 @@
+#if defined(NPSR_GAMMA_GAMMA_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_GAMMA_GAMMA_INL_H_
+#undef NPSR_GAMMA_GAMMA_INL_H_
+#else
+#define NPSR_GAMMA_GAMMA_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/dw-inl.h"               // TwoSum, TwoProd, MulDW
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReduced, Ldexp
+#include "npsr/gamma/data/data.h"
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // LogKernel, LogKernelDW
+#include "npsr/poly-inl.h"
+#include "npsr/trig/pi-inl.h"  // PiKernel
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::gamma {
+
+// Operation type of the gamma kernel
+enum class Operation { kLGamma = 0, kTGamma = 1 };
+
+// Start of Stirling's series, see npsr/gamma/data/gamma.h.sol
+template <typename T>
+inline constexpr T kStirlingBound = static_cast<T>(8.0);
+
+/**
+ * Below it, negative x skip the reflection formula: Γ(-a) = -Γ(a) and
+ * lgamma(-a) = lgamma(a) up to a relative 2γ·a, far below the ULP, while
+ * a·sin(πa) ≈ πa² stays normal above it.
+ */
+template <typename T>
+inline constexpr T kReflectionBound =
+    std::is_same_v<T, float> ? 0x1p-40f : 0x1p-100;
+
+/**
+ * Stirling's series of tgamma clamps a to it, where e^lgamma(a) already
+ * overflows and its reciprocal underflows. lgamma(a) then stays within the
+ * Cody-Waite head of exponential::Reduce<> and 2^m within what
+ * exponential::Ldexp<> can split.
+ */
+template <typename T>
+inline constexpr T kTGammaClamp = std::is_same_v<T, float> ? 48.0f : 300.0;
+
+/**
+ * lgamma(2 + t) for |t| ≤ 1/2 as a double-word hi + lo,
+ * t·c1 + t²·c2 + t³·P(t) with c1 = 1 - γ as hi + lo, see
+ * npsr/gamma/data/gamma.h.sol. The first two terms are exact double-words
+ * by TwoProd<> and dominate t³·P(t) by a factor 9, so its rounding
+ * stays far below the ULP, and the relative error holds around the zero at
+ * t = 0.
+ */
+template <typename V>
+NPSR_INTRIN V LGammaPoly(V t, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::gamma::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  constexpr auto kC1 = data::kLGammaC1<T>;
+  const V c2 = Set(d, data::kLGammaC2<T>);
+
+  V p_lo;
+  V p_hi = TwoProd(t, Set(d, kC1[0]), p_lo);
+  V s_lo;
+  V s = TwoProd(t, t, s_lo);
+  V u_lo;
+  V u = TwoProd(s, c2, u_lo);
+  u_lo = MulAdd(s_lo, c2, u_lo);
+  // t·c1 outweighs t²·c2 by 1.3/|t|
+  V sum = Add(p_hi, u);
+  V tail = Add(Sub(u, Sub(sum, p_hi)), Add(p_lo, u_lo));
+  tail = MulAdd(t, Set(d, kC1[1]), tail);
+  tail = MulAdd(Mul(s, t), Poly(t, data::kLGammaPoly<T>), tail);
+  V hi = Add(sum, tail);
+  lo = Sub(tail, Sub(hi, sum));
+  return hi;
+}
+
+/**
+ * lgamma(a) for a ≥ kStirlingBound as a double-word hi + lo by Stirling's
+ * series, given log(a) = l_hi + l_lo:
+ *   lgamma(a) = (a - 1/2)·(log(a) - 1) + c0 + S(1/a²)/a
+ * with c0 = log(2π)/2 - 1/2 as hi + lo, see npsr/gamma/data/gamma.h.sol.
+ * l_hi - 1 is exact, its product by a is split by TwoProd<> and
+ * every other term is smaller than it, so the sums are fast two-sums and
+ * the absolute error stays ~2^-digits below the ULP, as needed by tgamma
+ * to take e^lgamma(a).
+ */
+template <typename V>
+NPSR_INTRIN V LGammaStirling(V a, V l_hi, V l_lo, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::gamma::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  constexpr auto kC0 = data::kStirlingC0<T>;
+  const V one = Set(d, static_cast<T>(1.0));
+  const V half = Set(d, static_cast<T>(0.5));
+
+  const V h = Sub(l_hi, one);
+  V p_lo;
+  V p_hi = TwoProd(a, h, p_lo);
+  const V neg_half_h = Neg(Mul(h, half));
+  V s1 = Add(p_hi, neg_half_h);
+  V e1 = Sub(neg_half_h, Sub(s1, p_hi));
+  const V c0 = Set(d, kC0[0]);
+  V s2 = Add(s1, c0);
+  V e2 = Sub(c0, Sub(s2, s1));
+
+  const V r = Div(one, a);
+  V corr = Mul(r, Poly(Mul(r, r), data::kStirlingPoly<T>));
+  V tail = Add(Add(e1, e2), MulAdd(Sub(a, half), l_lo, p_lo));
+  tail = Add(tail, Add(Set(d, kC0[1]), corr));
+  V hi = Add(s2, tail);
+  lo = Sub(tail, Sub(hi, s2));
+  return hi;
+}
+
+/**
+ * This function computes the factor P of the recurrence that ties Γ(a) to
+ * Γ(2 + t), t = a - n, n = round(a) ≤ 8:
+ * - n ≥ 2: Γ(a) = Γ(2 + t)·P, P = (a - 1)·(a - 2)···(a - n + 2)
+ * - n ≤ 1: Γ(a) = Γ(2 + t)/P, P = a for n = 1 and a·(1 + a) for n = 0
+ * Every a - k is exact, as a multiple of ulp(a) smaller than a. With kHigh,
+ * P is a double-word hi + lo chained by TwoProd<>, otherwise the
+ * products round and lo is zero.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V GammaFactor(V a, V n, V &lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  V hi = IfThenElse(Ge(n, Set(d, static_cast<T>(3.0))), Sub(a, one), one);
+  lo = Zero(d);
+  for (int k = 2; k <= 6; ++k) {
+    const V f = IfThenElse(Ge(n, Set(d, static_cast<T>(k + 2))),
+                           Sub(a, Set(d, static_cast<T>(k))), one);
+    if constexpr (kHigh) {
+      V e;
+      hi = TwoProd(hi, f, e);
+      lo = MulAdd(lo, f, e);
+    } else {
+      hi = Mul(hi, f);
+    }
+  }
+
+  // a + a² rather than a·(1 + a), whose sum would round, a ≥ a² for n = 0
+  V s, s_lo;
+  if constexpr (kHigh) {
+    V sq_lo;
+    V sq = TwoProd(a, a, sq_lo);
+    s = Add(a, sq);
+    s_lo = Add(Sub(sq, Sub(s, a)), sq_lo);
+  } else {
+    s = MulAdd(a, a, a);
+    s_lo = Zero(d);
+  }
+  const auto is_zero = Eq(n, Zero(d));
+  const auto is_small = Le(n, one);
+  hi = IfThenElse(is_small, IfThenElse(is_zero, s, a), hi);
+  lo = IfThenElse(is_small, IfThenElseZero(is_zero, s_lo), lo);
+  return hi;
+}
+
+/**
+ * log(v_hi + v_lo) of a positive v_hi, subnormal v_hi being scaled into the
+ * normal range. With kHigh the result is a double-word hi + lo from
+ * logarithm::LogKernelDW<>, v_lo joining as v_lo/v_hi, otherwise it rounds
+ * and lo is zero.
+ */
+template <typename Prec, bool kHigh, typename V>
+NPSR_INTRIN V LogDW(V v_hi, V v_lo, V &lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  VI k_adj = Zero(di);
+  const auto is_sub = Lt(v_hi, Set(d, std::numeric_limits<T>::min()));
+  if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_sub))) {
+    constexpr int kShift = hwy::MantissaBits<T>() + 1;
+    const V scale = Set(d, kIsSingle ? 0x1p24f : 0x1p53);
+    v_hi = IfThenElse(is_sub, Mul(v_hi, scale), v_hi);
+    v_lo = IfThenElse(is_sub, Mul(v_lo, scale), v_lo);
+    k_adj = IfThenElseZero(RebindMask(di, is_sub), Set(di, -kShift));
+  }
+  if constexpr (kHigh) {
+    V hi = logarithm::LogKernelDW(v_hi, k_adj, lo);
+    lo = Add(lo, Div(v_lo, v_hi));
+    return hi;
+  } else {
+    lo = Zero(d);
+    return logarithm::LogKernel<logarithm::Operation::kLog, false>(
+        v_hi, Zero(d), k_adj);
+  }
+}
+
+/**
+ * sin(π·a) as a double-word hi + lo through trig::PiKernel<>. Float has no
+ * double-word form, it is rounded once from double and lo is zero.
+ */
+template <typename V>
+NPSR_INTRIN V SinPi(V a, V &lo) {
+  using namespace hn;
+  if constexpr (std::is_same_v<TFromV<V>, float>) {
+    lo = Zero(DFromV<V>());
+    return trig::PiKernel<trig::Operation::kSin>(a);
+  } else {
+    return trig::PiKernel<trig::Operation::kSin>(a, lo);
+  }
+}
+
+/**
+ * Whether GammaKernel<> takes its high tier under Prec. A kMaxULP<N>
+ * budget only selects the low tier when that tier meets it: tgamma
+ * measures up to ~5.3 ULP there, so it needs N ≥ 8. lgamma loses its
+ * relative accuracy around the zeros at negative x, far beyond any
+ * budget, so it keeps the high tier. Without a budget, kLowAccuracy
+ * selects the low tier of both.
+ */
+template <Operation OP, typename Prec>
+inline constexpr bool kGammaHigh =
+    Prec::kMaxULPBudget > 0
+        ? OP == Operation::kLGamma || Prec::kMaxULPBudget < 8
+        : Prec::kHighAccuracy;
+
+/**
+ * This function computes lgamma(x) = log|Γ(x)| or Γ(x), NaN aside, for
+ * finite x that aren't poles.
+ *
+ * Algorithm Overview:
+ * 1. Reduction: a = |x|, n = round(min(a, 8)) and t = a - n, exact, so
+ *    Γ(a) = Γ(2 + t)·P or Γ(2 + t)/P through the recurrence, see
+ *    GammaFactor<>, and lgamma(2 + t) comes from a minimax polynomial in t,
+ *    see LGammaPoly<>. a ≥ 8 takes Stirling's series instead, see
+ *    LGammaStirling<>.
+ *
+ * 2. lgamma: lgamma(2 + t) ± log(P), or Stirling's series, both as
+ *    double-words with kHighAccuracy, log(P) and log(a) from
+ *    logarithm::LogKernelDW<>. Negative x past kReflectionBound reflect:
+ *      lgamma(x) = log(π) - log(a·|sin(πa)|) - lgamma(a)
+ *    with sin(πa) from trig::PiKernel<>. The error stays relative around
+ *    the zeros of lgamma at 1 and 2, ~0.9 ULP at worst near the minimum
+ *    at 1.46 where log(P) cancels, but the reflection cancels near the
+ *    zeros at negative x, where only the absolute error is kept,
+ *    ~2^-digits.
+ *
+ * 3. tgamma: e^lgamma(2 + t) times or over P, the exponential being
+ *    exponential::ExpReducedDW<> and the product or quotient taken on
+ *    double-words with kHighAccuracy. Past a ≥ 8, e^lgamma(a) from
+ *    Stirling's series, which is always a double-word as its error is
+ *    scaled by lgamma(a) itself. Negative x past kReflectionBound reflect:
+ *      Γ(x) = -π/(a·sin(πa)·Γ(a))
+ *    the division taken before scaling by 2^-m, so Γ(a) may overflow while
+ *    Γ(x) is still representable. ~0.75 ULP error with kHighAccuracy,
+ *    ~1 ULP for the reflection without native FMA.
+ *
+ * Reflection, Stirling's series and the scaling of subnormal logarithm
+ * arguments are skipped for vectors without such lanes only under the
+ * default LargeArgument::kBranchy.
+ *
+ * Float with kHighAccuracy widens to the double low tier, ~0.5 ULP error.
+ * The low tiers round P, the exponential and the logarithms of the central
+ * range, ~4 ULP (lgamma) and ~5 ULP (tgamma) error, the worst cases being
+ * the cancellation near 1.46 and the reflection. Around the zeros at
+ * negative x the low tier of lgamma keeps a few ULP of 1 in absolute
+ * terms only, which is millions of ULP of the result. kHigh defaults to
+ * kGammaHigh<>.
+ */
+template <Operation OP, typename Prec, bool kHigh = kGammaHigh<OP, Prec>,
+          typename V>
+NPSR_INTRIN V GammaKernel(V x) {
+  using namespace hn;
+  namespace data = ::npsr::gamma::data;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  if constexpr (kIsSingle && kHigh) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo =
+        DemoteTo(dh, GammaKernel<OP, Prec, false>(PromoteLowerTo(dw, x)));
+    auto up =
+        DemoteTo(dh, GammaKernel<OP, Prec, false>(PromoteUpperTo(dw, x)));
+    return Combine(d, up, lo);
+  } else {
+    const RebindToSigned<decltype(d)> di;
+    const V zero = Zero(d);
+    const V one = Set(d, static_cast<T>(1.0));
+    const V bound = Set(d, kStirlingBound<T>);
+
+    const V a = Abs(x);
+    const auto is_big = Ge(a, bound);
+    const auto is_reflect = Lt(x, Set(d, -kReflectionBound<T>));
+    const V n = Round(Min(a, bound));
+    const auto is_div = Le(n, one);
+    V l_lo;
+    V l_hi = LGammaPoly(Sub(a, n), l_lo);
+    V p_lo;
+    V p_hi = GammaFactor<kHigh>(a, n, p_lo);
+
+    if constexpr (OP == Operation::kLGamma) {
+      // one logarithm serves log(P) and Stirling's log(a)
+      V w_lo;
+      V w = LogDW<Prec, kHigh>(IfThenElse(is_big, a, p_hi),
+                               IfThenElse(is_big, zero, p_lo), w_lo);
+      V c_lo;
+      V c_hi = TwoSum(l_hi, IfThenElse(is_div, Neg(w), w), c_lo);
+      c_lo = Add(c_lo, Add(l_lo, IfThenElse(is_div, Neg(w_lo), w_lo)));
+      V s_lo;
+      V s_hi = LGammaStirling(a, w, w_lo, s_lo);
+      V g_hi = IfThenElse(is_big, s_hi, c_hi);
+      V g_lo = IfThenElse(is_big, s_lo, c_lo);
+
+      if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_reflect))) {
+        constexpr auto kLnPi = data::kLnPi<T>;
+        V sin_lo;
+        V sin = SinPi(a, sin_lo);
+        sin_lo = IfThenElse(Lt(sin, zero), Neg(sin_lo), sin_lo);
+        V m_lo;
+        V m_hi = TwoProd(a, Abs(sin), m_lo);
+        m_lo = MulAdd(a, sin_lo, m_lo);
+        V r_lo;
+        V r = LogDW<Prec, kHigh>(m_hi, m_lo, r_lo);
+        V e1, e2;
+        V u = TwoSum(Set(d, kLnPi[0]), Neg(r), e1);
+        u = TwoSum(u, Neg(g_hi), e2);
+        V u_lo = Add(Add(e1, e2), Sub(Sub(Set(d, kLnPi[1]), r_lo), g_lo));
+        g_hi = IfThenElse(is_reflect, u, g_hi);
+        g_lo = IfThenElse(is_reflect, u_lo, g_lo);
+      }
+      return Add(g_hi, g_lo);
+    } else {
+      V e_hi = l_hi;
+      V e_lo = l_lo;
+      if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_big))) {
+        const V ac = Min(a, Set(d, kTGammaClamp<T>));
+        V w_lo;
+        V w = logarithm::LogKernelDW(Max(ac, bound), Zero(di), w_lo);
+        V s_lo;
+        V s_hi = LGammaStirling(ac, w, w_lo, s_lo);
+        e_hi = IfThenElse(is_big, s_hi, e_hi);
+        e_lo = IfThenElse(is_big, s_lo, e_lo);
+      }
+      V r_hi, r_lo;
+      VI k = exponential::Reduce<exponential::Operation::kExp, kHigh>(
+          e_hi, r_hi, r_lo);
+      const V r = Add(r_hi, Add(r_lo, e_lo));
+      VI m;
+      V y_hi, y_lo;
+      if constexpr (kHigh) {
+        y_hi = exponential::ExpReducedDW(k, r, m, y_lo);
+      } else {
+        y_hi = exponential::ExpReduced<false>(k, r, m);
+        y_lo = zero;
+      }
+
+      // Stirling's series is Γ(a) itself
+      p_hi = IfThenElse(is_big, one, p_hi);
+      p_lo = IfThenElse(is_big, zero, p_lo);
+      V g_hi, g_lo;
+      if constexpr (kHigh) {
+        V m_lo;
+        V m_hi = MulDW(y_hi, y_lo, p_hi, p_lo, m_lo);
+        V q = Div(y_hi, p_hi);
+        V qp_lo;
+        V qp = TwoProd(q, p_hi, qp_lo);
+        V rem = Add(Sub(Sub(y_hi, qp), qp_lo), NegMulAdd(q, p_lo, y_lo));
+        // the quotient overflows for subnormal a, where rem is NaN
+        g_hi = IfThenElse(is_div, q, m_hi);
+        g_lo = IfThenElse(is_div, IfThenElseZero(IsFinite(q), Div(rem, p_hi)),
+                          m_lo);
+      } else {
+        g_hi = IfThenElse(is_div, Div(y_hi, p_hi), Mul(y_hi, p_hi));
+        g_lo = zero;
+      }
+      V ret = CopySign(exponential::Ldexp(Add(g_hi, g_lo), m), x);
+
+      if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_reflect))) {
+        constexpr auto kPi = ::npsr::trig::data::kPi<T, true>;
+        const V pi = Set(d, kPi[0]);
+        V sin_lo;
+        V sin = SinPi(a, sin_lo);
+        V q;
+        if constexpr (kHigh) {
+          V den_lo;
+          V den = TwoProd(a, sin, den_lo);
+          den_lo = MulAdd(a, sin_lo, den_lo);
+          den = MulDW(den, den_lo, g_hi, g_lo, den_lo);
+          q = Div(pi, den);
+          V qd_lo;
+          V qd = TwoProd(q, den, qd_lo);
+          V rem = Sub(Sub(pi, qd), qd_lo);
+          rem = Add(rem, NegMulAdd(q, den_lo, Set(d, kPi[1])));
+          q = Add(q, Div(rem, den));
+        } else {
+          q = Div(pi, Mul(Mul(a, sin), g_hi));
+        }
+        ret = IfThenElse(is_reflect, exponential::Ldexp(Neg(q), Neg(m)), ret);
+      }
+      return ret;
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::gamma
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_GAMMA_GAMMA_INL_H_
@@ -0,0 +1,12 @@
+// Aggregates the hyperbolic data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Unlike the other modules there is no target-toggled table here, the
+// exponential tables come in through npsr/exponential/exp-inl.h, so the
+// guard is safe.
+#ifndef NPSR_HYPERBOLIC_DATA_DATA_H
+#define NPSR_HYPERBOLIC_DATA_DATA_H
+
+#include "npsr/hyperbolic/data/hyperbolic.h"
+
+#endif  // NPSR_HYPERBOLIC_DATA_DATA_H
@@ -0,0 +1,31 @@
+// Auto-generated by npsr/hyperbolic/data/hyperbolic.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_HYPERBOLIC_DATA_HYPERBOLIC_H
+#define NPSR_HYPERBOLIC_DATA_HYPERBOLIC_H
+
+namespace npsr::hyperbolic::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kSinhPoly[] = {};
+// sinh degree 9, |x| < 1, relative error 2^-31.125
+template <> inline constexpr float kSinhPoly<float>[] = {
+0x1.7687dp-19f, 0x1.a01d26p-13f, 0x1.1110e6p-7f, 0x1.555556p-3f, 
+};
+// sinh degree 15, |x| < 1, relative error 2^-61.5
+template <> inline constexpr double kSinhPoly<double>[] = {
+0x1.b54b0c718e5d9p-41, 0x1.61185b3da97bcp-33, 0x1.ae646d01f121p-26, 0x1.71de3a3dcef94p-19, 
+0x1.a01a01a034e83p-13, 0x1.1111111111027p-7, 0x1.5555555555556p-3, };
+
+template <typename T> inline constexpr char kTanhPoly[] = {};
+// tanh degree 9, |x| < 0.35, relative error 2^-30.25
+template <> inline constexpr float kTanhPoly<float>[] = {
+0x1.3c034p-6f, -0x1.b7e188p-5f, 0x1.110b2ap-3f, -0x1.55554cp-2f, 
+};
+// tanh degree 19, |x| < 0.35, relative error 2^-62.25
+template <> inline constexpr double kTanhPoly<double>[] = {
+-0x1.8996d18c79973p-13, 0x1.2eac8863631dp-11, -0x1.7d2b6b0c1e69cp-10, 0x1.d6cea94717f47p-9, 
+-0x1.226e23b84c2eep-7, 0x1.664f483933059p-6, -0x1.ba1ba1b96dc15p-5, 0x1.1111111110ad5p-3, 
+-0x1.5555555555553p-2, };
+
+} // namespace npsr::hyperbolic::data
+
+#endif // NPSR_HYPERBOLIC_DATA_HYPERBOLIC_H
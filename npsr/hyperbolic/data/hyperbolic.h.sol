@@ -0,0 +1,54 @@
+// Generates the minimax polynomials of the hyperbolic kernels
+// (see npsr/hyperbolic/hyperbolic-inl.h).
+//
+// Small arguments avoid the cancellation of e^x - e^-x and e^2x - 1, with
+// odd polynomials in the same form as asin:
+//   sinh(x) ≈ x + x³·P(x²),  |x| < 1
+//   tanh(x) ≈ x + x³·Q(x²),  |x| < 0.35
+// The leading term is kept exact so the kernel can add it last. Past these
+// bounds the kernels go through the exponential.
+//
+// Parameters:
+//   pName  - Name of the C++ array
+//   pF     - Function to approximate
+//   pFName - Name of the function in the comment
+//   pT     - Type descriptor (Float32 or Float64)
+//   pDeg   - Odd degree of the polynomial
+//   pMax   - Upper bound of |x|
+procedure Odd_(pName, pF, pFName, pT, pDeg, pMax) {
+  var i, $;
+  $.range = [2^-100; pMax];
+  $.monos = [||];
+  for i from 3 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.p = MinimaxCoeffs(pT, pF, $.monos, $.range, x);
+  $.array = CArrayT(pT, $.p.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// " @ pFName @ " degree " @ pDeg @ ", |x| < " @ pMax @
+    ", relative error 2^" @ round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " " @ pName @ "<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kSinhPoly[] = {};"
+);
+Append @ Odd_("kSinhPoly", sinh(x), "sinh", Float32, 9, 1);
+Append @ Odd_("kSinhPoly", sinh(x), "sinh", Float64, 15, 1);
+Append(
+  "",
+  "template <typename T> inline constexpr char kTanhPoly[] = {};"
+);
+Append @ Odd_("kTanhPoly", tanh(x), "tanh", Float32, 9, 0.35);
+Append @ Odd_("kTanhPoly", tanh(x), "tanh", Float64, 19, 0.35);
+Append("");
+
+WriteCPPHeader("npsr::hyperbolic::data");
@@ -0,0 +1,167 @@
+#if defined(NPSR_HYPERBOLIC_HYPERBOLIC_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_HYPERBOLIC_HYPERBOLIC_INL_H_
+#undef NPSR_HYPERBOLIC_HYPERBOLIC_INL_H_
+#else
+#define NPSR_HYPERBOLIC_HYPERBOLIC_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"               // TwoSum, TwoProd
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReduced, Pow2I
+#include "npsr/hwy.h"
+#include "npsr/hyperbolic/data/data.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::hyperbolic {
+
+// Operation type of the hyperbolic kernels
+enum class Operation { kSinh = 0, kCosh = 1, kTanh = 2 };
+
+/**
+ * This function computes sinh(x) ≈ x + x·w·P(w), w = x², for |x| < 1 with a
+ * minimax polynomial generated by npsr/hyperbolic/data/hyperbolic.h.sol.
+ * The correction is below x/6, so adding x last rounds once, ~0.7 ULP
+ * error near |x| = 1.
+ */
+template <typename V>
+NPSR_INTRIN V SinhPoly(V x) {
+  using namespace hn;
+  namespace data = ::npsr::hyperbolic::data;
+  using T = TFromV<V>;
+  V w = Mul(x, x);
+  return MulAdd(Mul(x, w), Poly(w, data::kSinhPoly<T>), x);
+}
+
+/// tanh(x) ≈ x + x·w·Q(w) for |x| < 0.35, see SinhPoly<>
+template <typename V>
+NPSR_INTRIN V TanhPoly(V x) {
+  using namespace hn;
+  namespace data = ::npsr::hyperbolic::data;
+  using T = TFromV<V>;
+  V w = Mul(x, x);
+  return MulAdd(Mul(x, w), Poly(w, data::kTanhPoly<T>), x);
+}
+
+/**
+ * This function computes e^x - e^-x (kSub) or e^x + e^-x as 2^m·g for
+ * 0 ≤ x within the clamped range, g ∈ [0.7, 2.1), so sinh and cosh are
+ * 2^(m-1)·g.
+ *
+ * Algorithm Overview:
+ * 1. Exponential: e^x = 2^m·e, see exponential::Reduce<>
+ *
+ * 2. Reciprocal: e^-x = 2^-2m·(2^m/e^x), 2^-2m clamped to the normal range,
+ *    where the term is far below the ULP of e anyway
+ *
+ * 3. Sum: g = e ± 2^-2m/e by two-sum
+ *
+ * With kHigh, e comes from the table as a double-word, see
+ * exponential::ExpReducedDW<>, and 1/e gets one Newton correction whose
+ * residual is exact, see TwoProd<>, so g rounds once on top of terms
+ * ~2^-6 ULP, ~0.55 ULP error. Otherwise e uses the polynomial over
+ * |r| ≤ ln2/2 and 1/e a plain division, ~1.5 ULP error.
+ */
+template <bool kHigh, bool kSub, typename V, typename VI>
+NPSR_INTRIN V ExpPair(V x, VI &m) {
+  using namespace hn;
+  using exponential::Operation;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  V r_hi, r_lo;
+  VI k = exponential::Reduce<Operation::kExp, kHigh>(x, r_hi, r_lo);
+  V e_lo = Zero(d);
+  V e_hi;
+  if constexpr (kHigh) {
+    e_hi = exponential::ExpReducedDW(k, Add(r_hi, r_lo), m, e_lo);
+  } else {
+    e_hi = exponential::ExpReduced<false>(k, Add(r_hi, r_lo), m);
+  }
+  const V scale = exponential::Pow2I(
+      d, Max(Neg(Add(m, m)), Set(di, 1 - exponential::kExpBias<T>)));
+  V inv = Div(one, e_hi);
+  if constexpr (!kHigh) {
+    V u = Mul(inv, scale);
+    return kSub ? Sub(e_hi, u) : Add(e_hi, u);
+  } else {
+    // 1/(e_hi + e_lo) ≈ inv·(1 + (1 - e_hi·inv - e_lo·inv))
+    V p_lo;
+    V p_hi = TwoProd(e_hi, inv, p_lo);
+    V resid = NegMulAdd(e_lo, inv, Sub(Sub(one, p_hi), p_lo));
+    V u_hi = Mul(inv, scale);
+    V u_lo = Mul(Mul(inv, resid), scale);
+    if constexpr (kSub) {
+      u_hi = Neg(u_hi);
+      u_lo = Neg(u_lo);
+    }
+    // For x ≈ 0, cosh has u ≈ e, so neither operand dominates the two-sum
+    V err;
+    V s = TwoSum(e_hi, u_hi, err);
+    return Add(s, Add(err, Add(e_lo, u_lo)));
+  }
+}
+
+/**
+ * This function computes tanh(x) for 0.35 ≤ x within the saturation bound,
+ * as 1 - 2/(e^2x + 1).
+ *
+ * Algorithm Overview:
+ * 1. Exponential: e^2x = 2^m·e, 2x is exact, see exponential::Reduce<>
+ *
+ * 2. Quotient: 2/(e^2x + 1) = 2^(1-m)/(e + 2^-m), the denominator summed by
+ *    two-sum and its reciprocal corrected as in ExpPair<>
+ *
+ * 3. Result: 1 - q by fast two-sum, q ≤ 0.67
+ *
+ * The subtraction amplifies the error of q at most twice, so with kHigh q is
+ * kept as a double-word throughout, ~0.55 ULP error. Otherwise
+ * 1 - 2/(2^m·e + 1) is rounded step by step, ~2 ULP error near x = 0.35.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V TanhKernel(V x) {
+  using namespace hn;
+  using exponential::Operation;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  V r_hi, r_lo;
+  VI m;
+  VI k = exponential::Reduce<Operation::kExp, kHigh>(Add(x, x), r_hi, r_lo);
+  if constexpr (!kHigh) {
+    V e = exponential::ExpReduced<false>(k, Add(r_hi, r_lo), m);
+    V e2x = exponential::LdexpFast(e, m);
+    return Sub(one, Div(Set(d, static_cast<T>(2.0)), Add(e2x, one)));
+  } else {
+    V e_lo;
+    V e_hi = exponential::ExpReducedDW(k, Add(r_hi, r_lo), m, e_lo);
+    const V t = exponential::Pow2I(d, Neg(m));
+    V den_lo;
+    V den_hi = TwoSum(e_hi, t, den_lo);
+    den_lo = Add(den_lo, e_lo);
+
+    V inv = Div(one, den_hi);
+    V p_lo;
+    V p_hi = TwoProd(den_hi, inv, p_lo);
+    V resid = NegMulAdd(den_lo, inv, Sub(Sub(one, p_hi), p_lo));
+    const V scale = exponential::Pow2I(d, Sub(Set(di, 1), m));
+    V q_hi = Mul(inv, scale);
+    V q_lo = Mul(Mul(inv, resid), scale);
+
+    V s = Sub(one, q_hi);
+    V err = Sub(Sub(one, s), q_hi);
+    return Add(s, Sub(err, q_lo));
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::hyperbolic
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_HYPERBOLIC_HYPERBOLIC_INL_H_
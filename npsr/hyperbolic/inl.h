@@ -0,0 +1,254 @@
+// Hyperbolic function dispatcher for Highway SIMD library
+// This file provides the public API for sinh(x), cosh(x) and tanh(x) with
+// configurable precision, special case handling and subnormal mode
+//
+// Small |x| take an odd polynomial, the others go through the exponential,
+// whose tier selects:
+// 1. Low precision: ~1.5-2 ULP error, polynomial exp over |r| ≤ ln2/2
+// 2. High precision: ~0.55-0.7 ULP error, 2^(j/32) table kept as a
+//    double-word
+
+#if defined(NPSR_HYPERBOLIC_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_HYPERBOLIC_INL_H_
+#undef NPSR_HYPERBOLIC_INL_H_
+#else
+#define NPSR_HYPERBOLIC_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/hwy.h"
+#include "npsr/hyperbolic/hyperbolic-inl.h"  // Polynomial and exp kernels
+#include "npsr/precise.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::hyperbolic {
+
+/**
+ * Bound of |x| under kSpecialCases for sinh and cosh. Past it the result
+ * already rounds to ±∞, and the clamped input keeps k within the Cody-Waite
+ * heads of exponential::Reduce<> and 2^m within what Ldexp<> can split.
+ */
+template <typename T>
+inline constexpr T kInputBound = std::is_same_v<T, float> ? 90.0f : 711.0;
+
+/**
+ * Saturation bound of tanh, past which 1 - tanh|x| ≈ 2·e^(-2|x|) is below
+ * half an ULP of 1 and the result rounds to ±1. |x| is always clamped to
+ * it, which also keeps e^(2|x|) and its reciprocal normal.
+ */
+template <typename T>
+inline constexpr T kTanhSaturation = std::is_same_v<T, float> ? 9.5f : 19.5;
+
+// Bound of the tanh polynomial, see npsr/hyperbolic/data/hyperbolic.h.sol
+template <typename T>
+inline constexpr T kTanhPolyBound = static_cast<T>(0.35);
+
+/**
+ * @brief Unified hyperbolic implementation
+ *
+ * @tparam OP       Operation type: kSinh, kCosh or kTanh
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * sinh and tanh work on |x| and restore the sign last. The polynomial
+ * covers |x| < 1 for sinh and |x| < 0.35 for tanh, and the exponential path
+ * is skipped for vectors without larger lanes only under the default
+ * LargeArgument::kBranchy. Under that policy, vectors whose lanes all
+ * saturate tanh also return ±1 right away.
+ *
+ * sinh and cosh scale by 2^m with a single integer add, which is only valid
+ * while the result stays normal. With kSpecialCases:
+ * - |x| is clamped to kInputBound<>, ±∞ included, and NaN propagates.
+ * - Lanes whose 2^m may overflow are redone with Ldexp<>, giving ±∞, and
+ *   overflow is raised for finite inputs unless kNoExceptions.
+ * - Subnormal x read as zero under Subnormal::kDAZ, and sinh and tanh of
+ *   them, which are x itself, flush to zero under Subnormal::kFTZ.
+ *   Otherwise they raise underflow unless kNoExceptions.
+ * With kNoSpecialCases, inputs must be finite and give normal results,
+ * others are unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V Hyperbolic(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+  const V ax = Abs(x);
+  (void)prec;
+
+  V ret;
+  if constexpr (OP == Operation::kTanh) {
+    const V sat = Set(d, kTanhSaturation<T>);
+    if (Prec::kBranchy && AllTrue(d, Ge(ax, sat))) {
+      return CopySignToAbs(one, x);
+    }
+    const auto is_small = Lt(ax, Set(d, kTanhPolyBound<T>));
+    ret = TanhPoly(ax);
+    if (!Prec::kBranchy || !AllTrue(d, is_small)) {
+      ret = IfThenElse(is_small, ret,
+                       TanhKernel<Prec::kHighAccuracy>(Min(ax, sat)));
+    }
+  } else {
+    constexpr bool kSub = OP == Operation::kSinh;
+    // cosh has no polynomial, nothing is below zero
+    const auto is_small = Lt(ax, kSub ? one : Zero(d));
+    if constexpr (kSub) {
+      ret = SinhPoly(ax);
+    }
+    if (!kSub || !Prec::kBranchy || !AllTrue(d, is_small)) {
+      V xc = ax;
+      if constexpr (Prec::kSpecialCases) {
+        xc = Min(ax, Set(d, kInputBound<T>));
+      }
+      VI m;
+      V g = ExpPair<Prec::kHighAccuracy, kSub>(xc, m);
+      m = Sub(m, Set(di, 1));
+      V big = exponential::LdexpFast(g, m);
+      if constexpr (Prec::kSpecialCases) {
+        const auto is_edge =
+            RebindMask(d, Gt(m, Set(di, exponential::kExpBias<T> - 2)));
+        if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_edge))) {
+          big = IfThenElse(is_edge, exponential::Ldexp(g, m), big);
+        }
+      }
+      // The polynomial lanes of sinh may hold anything here, even ±∞
+      ret = kSub ? IfThenElse(is_small, ret, big) : big;
+      if constexpr (Prec::kSpecialCases && Prec::kExceptions) {
+        prec.Raise(!AllFalse(d, And(IsFinite(x), IsInf(ret)))
+                       ? FPExceptions::kOverflow
+                       : 0);
+      }
+    }
+  }
+
+  if constexpr (OP != Operation::kCosh) {
+    if constexpr (Prec::kSpecialCases) {
+      const V min = Set(d, std::numeric_limits<T>::min());
+      if constexpr (Prec::kDAZ || Prec::kFTZ) {
+        ret = IfThenElseZero(Ge(ax, min), ret);
+      }
+      if constexpr (Prec::kExceptions && !Prec::kDAZ) {
+        const auto is_tiny = And(Lt(ax, min), Ne(ax, Zero(d)));
+        prec.Raise(!AllFalse(d, is_tiny) ? FPExceptions::kUnderflow : 0);
+      }
+    }
+    ret = CopySignToAbs(ret, x);
+  }
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(IsNaN(x), x, ret);
+  }
+  return ret;
+}
+
+/**
+ * @brief Applies Hyperbolic over a contiguous array.
+ *
+ * The remainder is handled with a partial load/store, whose zero padding
+ * never raises.
+ */
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void HyperbolicArray(Prec &prec, const T *in, size_t count,
+                                 T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Hyperbolic<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(Hyperbolic<OP>(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::hyperbolic
+
+// Public API in the main npsr namespace
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Compute sinh(x) of vector elements with configurable precision
+ *
+ * Evaluates an odd minimax polynomial for |x| < 1 and (e^x - e^-x)/2
+ * otherwise, e^x from the 2^(j/32) table kept as a double-word so the
+ * difference rounds once. Error: ~0.7 ULP by default (~0.75 ULP without
+ * native FMA), ~1.6 ULP with kLowAccuracy, which drops the table lookup for a longer polynomial.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       sinh(x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoSpecialCases};
+ * auto result = Sinh(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Sinh(Prec &prec, V x) {
+  return hyperbolic::Hyperbolic<hyperbolic::Operation::kSinh>(prec, x);
+}
+
+/**
+ * @brief Compute cosh(x) of vector elements, (e^x + e^-x)/2 for every x.
+ *
+ * Error: ~0.55 ULP by default, ~1.5 ULP with kLowAccuracy.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Cosh(Prec &prec, V x) {
+  return hyperbolic::Hyperbolic<hyperbolic::Operation::kCosh>(prec, x);
+}
+
+/**
+ * @brief Compute tanh(x) of vector elements with configurable precision
+ *
+ * Evaluates an odd minimax polynomial for |x| < 0.35 and
+ * 1 - 2/(e^2|x| + 1) up to the saturation bound, past which the result is
+ * ±1. Error: ~0.55 ULP by default, ~2 ULP with kLowAccuracy.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Tanh(Prec &prec, V x) {
+  return hyperbolic::Hyperbolic<hyperbolic::Operation::kTanh>(prec, x);
+}
+
+/**
+ * @brief Compute sinh(x) over an array with configurable precision
+ *
+ * @param prec   Precise object managing FP environment
+ * @param in     Input array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be in itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Sinh(Prec &prec, const T *in, size_t count, T *out) {
+  hyperbolic::HyperbolicArray<hyperbolic::Operation::kSinh>(prec, in, count,
+                                                            out);
+}
+
+/// Compute cosh(x) over an array, see the array overload of Sinh.
+template <typename Prec, typename T>
+NPSR_INTRIN void Cosh(Prec &prec, const T *in, size_t count, T *out) {
+  hyperbolic::HyperbolicArray<hyperbolic::Operation::kCosh>(prec, in, count,
+                                                            out);
+}
+
+/// Compute tanh(x) over an array, see the array overload of Sinh.
+template <typename Prec, typename T>
+NPSR_INTRIN void Tanh(Prec &prec, const T *in, size_t count, T *out) {
+  hyperbolic::HyperbolicArray<hyperbolic::Operation::kTanh>(prec, in, count,
+                                                            out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_HYPERBOLIC_INL_H_
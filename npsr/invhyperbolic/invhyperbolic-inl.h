@@ -0,0 +1,137 @@
+#if defined(NPSR_INVHYPERBOLIC_INVHYPERBOLIC_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_INVHYPERBOLIC_INVHYPERBOLIC_INL_H_
+#undef NPSR_INVHYPERBOLIC_INVHYPERBOLIC_INL_H_
+#else
+#define NPSR_INVHYPERBOLIC_INVHYPERBOLIC_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoSum, TwoProd
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // LogKernel
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::invhyperbolic {
+
+// Operation type of the inverse hyperbolic kernels
+enum class Operation { kAsinh = 0, kAcosh = 1, kAtanh = 2 };
+
+/**
+ * Bound past which asinh and acosh drop the square root, 2^12 (float) and
+ * 2^28 (double): √(a² ± 1) = a ± 1/(2a) then holds to ~2^-2·digits, and
+ * a² can't overflow below it.
+ */
+template <typename T>
+inline constexpr T kLargeBound = std::is_same_v<T, float> ? 0x1p12f : 0x1p28;
+
+/**
+ * This function computes √(q_hi + q_lo) as a double-word hi + lo, one
+ * Newton correction of the rounded root whose residual q_hi - s² is exact,
+ * see TwoProd<>. A zero root gets a zero low part.
+ */
+template <typename V>
+NPSR_INTRIN V SqrtDW(V q_hi, V q_lo, V &lo) {
+  using namespace hn;
+  const DFromV<V> d;
+  V s = Sqrt(q_hi);
+  V p_lo;
+  V p_hi = TwoProd(s, s, p_lo);
+  V resid = Add(Sub(Sub(q_hi, p_hi), p_lo), q_lo);
+  lo = IfThenElseZero(Gt(s, Zero(d)), Div(resid, Add(s, s)));
+  return s;
+}
+
+/**
+ * This function computes the argument u of the logarithm behind asinh,
+ * acosh and atanh as a double-word hi + lo, so that
+ * - asinh(a) = log(u), u = a + √(a² + 1), for a = |x|
+ * - acosh(a) = log(u), u = a + √(a² - 1), for a ≥ 1
+ * - atanh(a) = log(u)/2, u = 1 + 2a/(1 - a), for a = |x| < 1
+ * and logarithm::LogKernel<> in its log1p form takes hi and lo without
+ * rounding their sum. k_adj is added to the exponent of hi.
+ *
+ * Small arguments put u close to 1, where the result is about the part of u
+ * past 1 and needs its every bit:
+ * - With kHigh, every step is double-word: a² by TwoProd<>, the
+ *   root by SqrtDW<> and the quotient with an exact residual, so only terms
+ *   ~2^-2·digits round, ~0.55 ULP error after the logarithm.
+ * - Otherwise u = 1 + t with t = a + a²/(1 + √(a² + 1)),
+ *   (a - 1) + √((a - 1)(a + 1)) or 2a/(1 - a), the classic log1p forms,
+ *   each rounding a few times, ~1.5-2.5 ULP error.
+ *
+ * Past kLargeBound<>, asinh and acosh use u = 2·(a ± 1/(4a)) with k_adj
+ * holding the factor 2, so neither a² nor 2a can overflow.
+ */
+template <Operation OP, bool kHigh, typename V, typename VI>
+NPSR_INTRIN V LogArgument(V a, V &lo, VI &k_adj) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  V u_hi, u_lo;
+  if constexpr (OP == Operation::kAtanh) {
+    k_adj = Zero(di);
+    if constexpr (kHigh) {
+      // t = 2a/(1 - a) as a double-word, 1 - a by fast two-sum since a < 1.
+      // Every residual is relative to t, not to 1 + t
+      V n = Add(a, a);
+      V d_hi = Sub(one, a);
+      V d_lo = Sub(Sub(one, d_hi), a);
+      V t_hi = Div(n, d_hi);
+      V p_lo;
+      V p_hi = TwoProd(t_hi, d_hi, p_lo);
+      V t_lo = Div(NegMulAdd(t_hi, d_lo, Sub(Sub(n, p_hi), p_lo)), d_hi);
+      u_hi = TwoSum(t_hi, one, lo);
+      lo = Add(lo, t_lo);
+      return u_hi;
+    } else {
+      V t = Div(Add(a, a), Sub(one, a));
+      u_hi = TwoSum(t, one, lo);
+      return u_hi;
+    }
+  } else {
+    const V bound = Set(d, kLargeBound<T>);
+    const auto is_large = Gt(a, bound);
+    // Keeps a² finite in the lanes replaced below
+    const V ab = Min(a, bound);
+    if constexpr (kHigh) {
+      V a2_lo;
+      V a2_hi = TwoProd(ab, ab, a2_lo);
+      V c = OP == Operation::kAsinh ? one : Neg(one);
+      V q_lo;
+      V q_hi = TwoSum(a2_hi, c, q_lo);
+      q_lo = Add(q_lo, a2_lo);
+      V s_lo;
+      V s_hi = SqrtDW(q_hi, q_lo, s_lo);
+      // a ≥ √(a² - 1) for acosh, √(a² + 1) > a for asinh
+      V big = OP == Operation::kAsinh ? s_hi : ab;
+      V small = OP == Operation::kAsinh ? ab : s_hi;
+      u_hi = Add(big, small);
+      u_lo = Add(Add(Sub(big, u_hi), small), s_lo);
+    } else {
+      V t;
+      if constexpr (OP == Operation::kAsinh) {
+        V a2 = Mul(ab, ab);
+        t = Add(ab, Div(a2, Add(one, Sqrt(Add(a2, one)))));
+      } else {
+        V am1 = Sub(ab, one);
+        t = Add(am1, Sqrt(Mul(am1, Add(ab, one))));
+      }
+      u_hi = TwoSum(t, one, u_lo);
+    }
+    const V quarter = Set(d, static_cast<T>(0.25));
+    V inv = Div(quarter, a);
+    lo = IfThenElse(is_large, OP == Operation::kAsinh ? inv : Neg(inv), u_lo);
+    k_adj = IfThenElseZero(RebindMask(di, is_large), Set(di, 1));
+    return IfThenElse(is_large, a, u_hi);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::invhyperbolic
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_INVHYPERBOLIC_INVHYPERBOLIC_INL_H_
@@ -0,0 +1,115 @@
+#if defined(NPSR_INVTRIG_ASIN_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_INVTRIG_ASIN_INL_H_
+#undef NPSR_INVTRIG_ASIN_INL_H_
+#else
+#define NPSR_INVTRIG_ASIN_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/invtrig/data/data.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::invtrig {
+
+// Operation type of the inverse trigonometric kernels, kAtan is served by
+// atan-inl.h
+enum class Operation { kAsin = 0, kAcos = 1, kAtan = 2 };
+
+/**
+ * This function computes asin(x) or acos(x) for any x, NaN outside [-1, 1].
+ *
+ * Algorithm Overview:
+ * 1. Argument Folding: with a = |x|
+ *    - a ≤ 0.5: z = a², s = a
+ *    - a > 0.5: z = (1 - a)/2, s = √z, using asin(a) = π/2 - 2·asin(s)
+ *    Both keep z ≤ 0.25, and 1 - a is exact by Sterbenz lemma.
+ *
+ * 2. Polynomial Approximation: asin(s) ≈ s + s·z·P(z), a minimax polynomial
+ *    generated by npsr/invtrig/data/asin.h.sol
+ *
+ * 3. Reconstruction as C + m·asin(s), m a power of two:
+ *    - asin: a for a ≤ 0.5, π/2 - 2·asin(s) otherwise, then the sign of x
+ *    - acos: π/2 - asin(x) for a ≤ 0.5, 2·asin(s) for x > 0.5 and
+ *      π - 2·asin(s) for x < -0.5
+ *    |m·s| ≤ |C| whenever C ≠ 0, so a fast two-sum captures the rounding
+ *    error of the leading subtraction.
+ *
+ * With kCompensated, C is carried as a double-word constant together with
+ * that rounding error, and the rounding error of √z is recovered by FMA when
+ * the target fuses it, ~0.75 ULP error with native FMA and ~1.2 ULP without.
+ * Otherwise the reconstruction is plain, ~2 ULP error.
+ */
+template <Operation OP, bool kCompensated, typename V>
+NPSR_INTRIN V AsinAcos(V x) {
+  using namespace hn;
+  namespace data = ::npsr::invtrig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const V half = Set(d, static_cast<T>(0.5));
+  const V two = Set(d, static_cast<T>(2.0));
+
+  // Step 1: Fold the argument
+  const V a = Abs(x);
+  const auto is_small = Le(a, half);
+  V z = IfThenElse(is_small, Mul(a, a), Mul(Sub(Set(d, 1.0), a), half));
+  V sqrt_z = Sqrt(z);
+  V s = IfThenElse(is_small, a, sqrt_z);
+  if constexpr (OP == Operation::kAcos) {
+    // π/2 - asin(x) keeps the sign of x inside the polynomial
+    s = IfThenElse(is_small, x, s);
+  }
+
+  // Step 2: asin(s) ≈ s + s·z·P(z), tail kept apart from s
+  V poly = Poly(z, data::kAsinPoly<T>);
+  V p_lo = Mul(Mul(s, z), poly);
+  if constexpr (kCompensated && kNativeFMA) {
+    // √z = s + (z - s²)/(2·s), the residual is exact with FMA. Lanes with
+    // z = 0 (|x| = 1) are exact and must not divide by zero.
+    V s_lo = Div(NegMulAdd(sqrt_z, sqrt_z, z), Add(sqrt_z, sqrt_z));
+    const auto has_lo = AndNot(is_small, Gt(z, Zero(d)));
+    p_lo = Add(p_lo, IfThenElseZero(has_lo, s_lo));
+  }
+
+  // Step 3: C + m·asin(s)
+  constexpr auto kHalfPi = data::kHalfPi<T>;
+  V c_hi, c_lo, m;
+  if constexpr (OP == Operation::kAsin) {
+    c_hi = IfThenElseZero(Not(is_small), Set(d, kHalfPi[0]));
+    c_lo = IfThenElseZero(Not(is_small), Set(d, kHalfPi[1]));
+    m = IfThenElse(is_small, Set(d, 1.0), Set(d, -2.0));
+  } else {
+    const auto is_neg = Lt(x, Zero(d));
+    // 0 for x > 0.5, π/2 for the small range and π for x < -0.5
+    V c_scale = IfThenElse(is_small, Set(d, 1.0),
+                           IfThenElseZero(is_neg, two));
+    c_hi = Mul(c_scale, Set(d, kHalfPi[0]));
+    c_lo = Mul(c_scale, Set(d, kHalfPi[1]));
+    m = IfThenElse(is_small, Set(d, -1.0),
+                   IfThenElse(is_neg, Set(d, -2.0), two));
+  }
+  V y_hi = Mul(m, s);
+  V y_lo = Mul(m, p_lo);
+  V ret;
+  if constexpr (kCompensated) {
+    V hi = Add(c_hi, y_hi);
+    V lo = Add(Sub(c_hi, hi), y_hi);
+    lo = Add(lo, Add(c_lo, y_lo));
+    ret = Add(hi, lo);
+  } else {
+    ret = Add(c_hi, Add(y_hi, y_lo));
+  }
+  if constexpr (OP == Operation::kAsin) {
+    // asin is odd, also keeps asin(-0) = -0
+    ret = CopySignToAbs(ret, x);
+  }
+  return ret;
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::invtrig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_INVTRIG_ASIN_INL_H_
@@ -0,0 +1,124 @@
+#if defined(NPSR_INVTRIG_ATAN_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_INVTRIG_ATAN_INL_H_
+#undef NPSR_INVTRIG_ATAN_INL_H_
+#else
+#define NPSR_INVTRIG_ATAN_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/invtrig/data/data.h"
+#include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::invtrig {
+
+/**
+ * This function computes the angle of atan2 from p = min(|y|, |x|),
+ * q = max(|y|, |x|) and the octant bits, bit 0 set when |y| > |x| and bit 1
+ * when x is negative. Returns θ ∈ [0, π], the sign of y is left to the
+ * caller.
+ *
+ * Algorithm Overview:
+ * 1. Table Reduction: c = j/8 nearest to p/q with j ≤ 7, the ratio taken
+ *    with an approximate reciprocal since it only picks j, then
+ *    atan(p/q) = atan(c) + atan(u), u = (p - c·q)/(q + c·p), |u| ≤ 1/15
+ *
+ * 2. Table Lookup: Retrieves the base angle of k = 16·neg + 8·swap + j as
+ *    high and low parts, atan(c), π/2 - atan(c), π - atan(c) or
+ *    π/2 + atan(c), so swap and reflection cost no arithmetic and u only
+ *    changes sign when exactly one of them applies
+ *
+ * 3. Polynomial Approximation: atan(u) ≈ u + u³·P(u²), a minimax polynomial
+ *    generated by npsr/invtrig/data/atan.h.sol
+ *
+ * With kCompensated, the products c·q and c·p are split exactly by FMA, u
+ * is carried as a double-word quotient refined by one correction step, and
+ * the base angle as a double-word pair, ~0.5 ULP error with native FMA
+ * (subnormal results round twice, ~1.3 ULP).
+ * Otherwise u is a single division added to the high part, ~1-2 ULP error.
+ *
+ * p and q are scale free but c·p + q must not overflow, see Atan2<>.
+ */
+template <bool kCompensated, typename V, typename VI>
+NPSR_INTRIN V AtanKernel(V p, V q, VI octant) {
+  using namespace hn;
+  namespace data = ::npsr::invtrig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  // Step 1: j = min(round(8·p/q), 7). The scale is shrunk by 2^-7 to cover
+  // the error of the reciprocal estimate (2^-8 on some targets), so that
+  // c·q never exceeds 2·p and p - c·q stays exact for j = 1
+  const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
+  V ratio = Mul(p, ApproximateReciprocal(q));
+  V j_biased = MulAdd(ratio, Set(d, static_cast<T>(8.0 - 8.0 / 128)),
+                      magic_round);
+  j_biased = Min(j_biased, Add(magic_round, Set(d, static_cast<T>(7.0))));
+  V c = Mul(Sub(j_biased, magic_round), Set(d, static_cast<T>(0.125)));
+
+  // Step 2: Load the base angle, u flips sign when swap ≠ neg
+  VI k = Or(And(BitCast(di, j_biased), Set(di, 7)), ShiftLeft<3>(octant));
+  V base_hi, base_lo;
+  if constexpr (kIsSingle) {
+    kAtanTableF32.Load(BitCast(du, k), base_hi, base_lo);
+  } else {
+    kAtanTableF64.Load(BitCast(du, k), base_hi, base_lo);
+  }
+  VI flip = And(Xor(octant, ShiftRight<1>(octant)), Set(di, 1));
+  V sign = BitCast(d, ShiftLeft<sizeof(T) * 8 - 1>(flip));
+
+  V ret;
+  if constexpr (kCompensated) {
+    // p - c·q: c·q lies within p ± q/16, so for j ≠ 0 the subtraction of
+    // the rounded product is exact and only its error needs adding back
+    V cq = Mul(c, q);
+    V cq_lo = MulSub(c, q, cq);
+    V num0 = Sub(p, cq);
+    V num_hi = Sub(num0, cq_lo);
+    V num_bv = Sub(num_hi, num0);
+    V num_lo = Add(Sub(num0, Sub(num_hi, num_bv)), Neg(Add(cq_lo, num_bv)));
+    // q + c·p, q dominates so the fast two-sum is exact
+    V cp = Mul(c, p);
+    V cp_lo = MulSub(c, p, cp);
+    V den_hi = Add(q, cp);
+    V den_lo = Add(Add(Sub(q, den_hi), cp), cp_lo);
+    // u = num/den refined by the remainder (num - u·den)/den, one division
+    V recip = Div(Set(d, static_cast<T>(1.0)), den_hi);
+    V u = Mul(num_hi, recip);
+    V rem = NegMulAdd(u, den_hi, num_hi);
+    rem = Add(rem, num_lo);
+    rem = NegMulAdd(u, den_lo, rem);
+    V u_lo = Mul(rem, recip);
+    u = Xor(u, sign);
+    u_lo = Xor(u_lo, sign);
+
+    // Step 3: atan(u) ≈ u + u³·P(u²), the u_lo·u² term is below the rounding
+    V u2 = Mul(u, u);
+    V poly = Poly(u2, data::kAtanPoly<T>);
+    V tail = MulAdd(Mul(u2, u), poly, u_lo);
+    // |u| < |base_hi| unless the base angle is zero, exact as well
+    V hi = Add(base_hi, u);
+    V lo = Add(Sub(base_hi, hi), u);
+    lo = Add(lo, Add(base_lo, tail));
+    ret = Add(hi, lo);
+  } else {
+    V u = Div(NegMulAdd(c, q, p), MulAdd(c, p, q));
+    u = Xor(u, sign);
+    V u2 = Mul(u, u);
+    V poly = Poly(u2, data::kAtanPoly<T>);
+    ret = Add(base_hi, MulAdd(Mul(u2, u), poly, u));
+  }
+  return ret;
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::invtrig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_INVTRIG_ATAN_INL_H_
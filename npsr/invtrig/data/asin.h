@@ -0,0 +1,28 @@
+// Auto-generated by npsr/invtrig/data/asin.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_INVTRIG_DATA_ASIN_H
+#define NPSR_INVTRIG_DATA_ASIN_H
+
+namespace npsr::invtrig::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kAsinPoly[] = {};
+// asin degree 11, relative error 2^-27
+template <> inline constexpr float kAsinPoly<float>[] = {
+0x1.61e1b4p-5f, 0x1.83647p-6f, 0x1.7538cap-5f, 0x1.32fcccp-4f, 
+0x1.5555ccp-3f, };
+// asin degree 29, relative error 2^-59.5
+template <> inline constexpr double kAsinPoly<double>[] = {
+0x1.19f7439fe2ca2p-5, -0x1.bd9e8dd141d16p-6, 0x1.a0e852bf42bbbp-6, 0x1.ec0094bd9be11p-12, 
+0x1.4994fe8714c72p-7, 0x1.36836eaca4472p-7, 0x1.7babcfe9304a4p-7, 0x1.c980361bca10ap-7, 
+0x1.1c4f8a71b52ffp-6, 0x1.6e8b9ac9dd859p-6, 0x1.f1c71ca88a315p-6, 0x1.6db6db6d49f55p-5, 
+0x1.3333333333a08p-4, 0x1.5555555555553p-3, };
+
+template <typename T> inline constexpr char kHalfPi[] = {};
+template <> inline constexpr float kHalfPi<float>[] = {
+0x1.921fb6p0f, -0x1.777a5cp-25f, };
+template <> inline constexpr double kHalfPi<double>[] = {
+0x1.921fb54442d18p0, 0x1.1a62633145c07p-54, };
+
+} // namespace npsr::invtrig::data
+
+#endif // NPSR_INVTRIG_DATA_ASIN_H
@@ -0,0 +1,52 @@
+// Generates the minimax polynomials and constants of the arcsine kernel
+// (see npsr/invtrig/asin-inl.h).
+//
+// The argument is folded to s ≤ 0.5, either s = |x| or s = √((1 - |x|)/2),
+// so with z = s² the polynomial only has to cover z ≤ 0.25:
+//   asin(s) ≈ s + s·z·P(z)
+// which is the odd polynomial s + s³·P(s²) below, with the leading term kept
+// exact so the kernel can add it last.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Odd degree of the polynomial
+procedure Asin_(pT, pDeg) {
+  var i, $;
+  $.range = [2^-100; 0.5];
+  $.monos = [||];
+  for i from 3 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.asin = MinimaxCoeffs(pT, asin(x), $.monos, $.range, x);
+  $.array = CArrayT(pT, $.asin.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// asin degree " @ pDeg @ ", relative error 2^" @
+    round(log2($.asin.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kAsinPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kAsinPoly[] = {};"
+);
+Append @ Asin_(Float32, 11);
+Append @ Asin_(Float64, 29);
+Append(
+  "",
+  // π/2 as a double-word pair, π is the same pair doubled
+  "template <typename T> inline constexpr char kHalfPi[] = {};",
+  "template <> inline constexpr float kHalfPi<float>[] = " @
+  CArrayT(Float32, Constants(pi/2, [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kHalfPi<double>[] = " @
+  CArrayT(Float64, Constants(pi/2, [|RN, 53, 53|]), 4) @ ";",
+  ""
+);
+
+WriteCPPHeader("npsr::invtrig::data");
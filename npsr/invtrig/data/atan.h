@@ -0,0 +1,19 @@
+// Auto-generated by npsr/invtrig/data/atan.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_INVTRIG_DATA_ATAN_H
+#define NPSR_INVTRIG_DATA_ATAN_H
+
+namespace npsr::invtrig::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kAtanPoly[] = {};
+// atan degree 5, relative error 2^-30.125
+template <> inline constexpr float kAtanPoly<float>[] = {
+0x1.97a47ep-3f, -0x1.5554fap-2f, };
+// atan degree 11, relative error 2^-60.25
+template <> inline constexpr double kAtanPoly<double>[] = {
+-0x1.70b59d96766acp-4, 0x1.c718975070f5fp-4, -0x1.2492484b3a0a5p-3, 0x1.9999999974db8p-3, 
+-0x1.5555555555544p-2, };
+
+} // namespace npsr::invtrig::data
+
+#endif // NPSR_INVTRIG_DATA_ATAN_H
@@ -0,0 +1,42 @@
+// Generates the minimax polynomials of the arctangent kernel
+// (see npsr/invtrig/atan-inl.h).
+//
+// The argument is reduced against the nearest eighth c = j/8 of the ratio
+// t ∈ [0, 1], u = (t - c)/(1 + c·t), with j capped at 7, so the polynomial
+// only has to cover |u| ≤ 1/15:
+//   atan(u) ≈ u + u³·P(u²)
+// The leading term is kept exact so the kernel can add it last. The range
+// is widened slightly to absorb the approximate reciprocal behind j.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Odd degree of the polynomial
+procedure Atan_(pT, pDeg) {
+  var i, $;
+  $.range = [2^-100; 1/15 * (1 + 2^-8)];
+  $.monos = [||];
+  for i from 3 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.atan = MinimaxCoeffs(pT, atan(x), $.monos, $.range, x);
+  $.array = CArrayT(pT, $.atan.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// atan degree " @ pDeg @ ", relative error 2^" @
+    round(log2($.atan.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kAtanPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kAtanPoly[] = {};"
+);
+Append @ Atan_(Float32, 5);
+Append @ Atan_(Float64, 11);
+Append("");
+
+WriteCPPHeader("npsr::invtrig::data");
@@ -0,0 +1,63 @@
+// Auto-generated by npsr/invtrig/data/atan8-inl.h.sol
+// Use `spin sollya -f` to force regeneration
+#if defined(NPSR_INVTRIG_DATA_ATAN8_INL_H) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_INVTRIG_DATA_ATAN8_INL_H
+#undef NPSR_INVTRIG_DATA_ATAN8_INL_H
+#else
+#define NPSR_INVTRIG_DATA_ATAN8_INL_H
+#endif
+
+HWY_BEFORE_NAMESPACE();
+namespace npsr::HWY_NAMESPACE::invtrig {
+inline constexpr auto kAtanTableF32 = MakeLut<float>(
+// High parts of the base angle of k = 16·neg + 8·swap + j
+{
+0.0f, 0x1.fd5baap-4f, 0x1.f5b76p-3f, 0x1.6f6194p-2f, 
+0x1.dac67p-2f, 0x1.1e00bap-1f, 0x1.4978fap-1f, 0x1.700a7cp-1f, 
+0x1.921fb6p0f, 0x1.7249fap0f, 0x1.5368cap0f, 0x1.36475p0f, 
+0x1.1b6e1ap0f, 0x1.031f58p0f, 0x1.dac67p-1f, 0x1.b434eep-1f, 
+0x1.921fb6p1f, 0x1.8234d8p1f, 0x1.72c44p1f, 0x1.643382p1f, 
+0x1.56c6e8p1f, 0x1.4a9f86p1f, 0x1.3fc176p1f, 0x1.361d16p1f, 
+0x1.921fb6p0f, 0x1.b1f57p0f, 0x1.d0d6a2p0f, 0x1.edf81ap0f, 
+0x1.0468a8p1f, 0x1.10900ap1f, 0x1.1b6e1ap1f, 0x1.25127ap1f, 
+},
+// Low parts of the base angle of k = 16·neg + 8·swap + j
+{
+0.0f, -0x1.54f424p-30f, -0x1.b4dfc8p-29f, 0x1.e4defp-30f, 
+0x1.586ed4p-28f, 0x1.7bdfd6p-26f, 0x1.934f7p-28f, 0x1.5e118cp-27f, 
+-0x1.777a5cp-25f, 0x1.532d44p-25f, -0x1.5c2c6p-25f, 0x1.e57aaep-27f, 
+-0x1.a28838p-25f, -0x1.ab5242p-28f, 0x1.586ed4p-27f, 0x1.8809fep-28f, 
+-0x1.777a5cp-24f, -0x1.2268c6p-28f, -0x1.69d35ep-24f, 0x1.80f228p-24f, 
+-0x1.8d014ap-24f, 0x1.298daep-24f, 0x1.6f50acp-24f, 0x1.730dc6p-26f, 
+-0x1.777a5cp-25f, -0x1.0887f8p-27f, -0x1.92c85ap-25f, 0x1.2f5936p-26f, 
+0x1.59c9bep-24f, -0x1.5cc538p-24f, -0x1.a28838p-24f, -0x1.1ff5fap-25f, 
+}
+);
+inline constexpr auto kAtanTableF64 = MakeLut<double>(
+// High parts of the base angle of k = 16·neg + 8·swap + j
+{
+0.0, 0x1.fd5ba9aac2f6ep-4, 0x1.f5b75f92c80ddp-3, 0x1.6f61941e4def1p-2, 
+0x1.dac670561bb4fp-2, 0x1.1e00babdefeb4p-1, 0x1.4978fa3269ee1p-1, 0x1.700a7c5784634p-1, 
+0x1.921fb54442d18p0, 0x1.7249faa996a21p0, 0x1.5368c951e9cfdp0, 0x1.3647503caf55cp0, 
+0x1.1b6e192ebbe44p0, 0x1.031f57e54adbep0, 0x1.dac670561bb4fp-1, 0x1.b434ee31013fdp-1, 
+0x1.921fb54442d18p1, 0x1.8234d7f6ecb9dp1, 0x1.72c43f4b1650ap1, 0x1.643382c07913ap1, 
+0x1.56c6e7397f5aep1, 0x1.4a9f8694c6d6bp1, 0x1.3fc176b7a856p1, 0x1.361d162e61b8bp1, 
+0x1.921fb54442d18p0, 0x1.b1f56fdeef00fp0, 0x1.d0d6a1369bd34p0, 0x1.edf81a4bd64d4p0, 
+0x1.0468a8ace4df6p1, 0x1.109009519d639p1, 0x1.1b6e192ebbe44p1, 0x1.251279b802819p1, 
+},
+// Low parts of the base angle of k = 16·neg + 8·swap + j
+{
+0.0, -0x1.cd37686760c17p-59, 0x1.8ab6e3cf7afbdp-57, -0x1.c63aae6f6e918p-56, 
+0x1.a2b7f222f65e2p-56, -0x1.928df287a668fp-58, 0x1.2419a87f2a458p-56, -0x1.8c34d25aadef6p-56, 
+0x1.1a62633145c07p-54, 0x1.a8cc1e7480c68p-54, -0x1.96f47948a99f1p-54, 0x1.17e21d9a42c9ap-55, 
+0x1.b1b466a88828ep-54, 0x1.338b4259c027p-54, 0x1.a2b7f222f65e2p-55, -0x1.0520d0701d877p-55, 
+0x1.1a62633145c07p-53, -0x1.3cd17e5a39792p-54, 0x1.c1b6f4f44e10bp-53, 0x1.a65371fe67254p-54, 
+0x1.660b64ece6f4bp-53, 0x1.26f6d2c582f3bp-53, -0x1.441a3bd3f1083p-58, 0x1.4be8fd7c9b7e6p-53, 
+0x1.1a62633145c07p-54, 0x1.17f14fdc1574cp-55, -0x1.a23602a65700cp-57, 0x1.a8d3b7956a1c1p-54, 
+0x1.0620bf7406affp-55, 0x1.01398408cb59ep-54, 0x1.b1b466a88828ep-53, 0x1.6eaa5d3534893p-55, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_INVTRIG_DATA_ATAN8_INL_H(){}
+} // namespace npsr::HWY_NAMESPACE::invtrig
+HWY_AFTER_NAMESPACE();
+#endif // NPSR_INVTRIG_DATA_ATAN8_INL_H
\ No newline at end of file
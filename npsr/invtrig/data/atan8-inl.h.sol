@@ -0,0 +1,52 @@
+// Generates the lookup table of the arctangent kernel
+// (see npsr/invtrig/atan-inl.h).
+//
+// The kernel computes atan2(y, x) from p = min(|y|, |x|), q = max(|y|, |x|)
+// and c = j/8 the nearest eighth to p/q:
+//   atan(p/q) = atan(c) + atan(u),  u = (p - c·q)/(q + c·p)
+// then swaps to π/2 - atan(p/q) when |y| > |x| and reflects to π - θ when x
+// is negative. The table folds all of it into the column
+//   k = 16·neg + 8·swap + j
+// so quadrant and sign come from a single lookup, and the kernel only flips
+// the sign of u when exactly one of swap and neg is set.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pLow - false for the high parts, true for the low parts
+procedure AtanTable_(pT, pLow) {
+  var r, neg, swap, j, $;
+  r = [||];
+  for neg from 0 to 1 do {
+    for swap from 0 to 1 do {
+      for j from 0 to 7 do {
+        $.exact = atan(j / 8);
+        if (swap == 1) then $.exact = pi / 2 - $.exact;
+        if (neg == 1) then $.exact = pi - $.exact;
+        $.hi = pT.kRound($.exact);
+        if (pLow) then {
+          r = r :. pT.kRound($.exact - $.hi);
+        } else {
+          r = r :. $.hi;
+        };
+      };
+    };
+  };
+  return CArrayT(pT, r, 4);
+};
+
+Append(
+  "inline constexpr auto kAtanTableF32 = MakeLut<float>(",
+  "// High parts of the base angle of k = 16·neg + 8·swap + j",
+  AtanTable_(Float32, false) @ ",",
+  "// Low parts of the base angle of k = 16·neg + 8·swap + j",
+  AtanTable_(Float32, true),
+  ");",
+  "inline constexpr auto kAtanTableF64 = MakeLut<double>(",
+  "// High parts of the base angle of k = 16·neg + 8·swap + j",
+  AtanTable_(Float64, false) @ ",",
+  "// Low parts of the base angle of k = 16·neg + 8·swap + j",
+  AtanTable_(Float64, true),
+  ");"
+);
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::invtrig");
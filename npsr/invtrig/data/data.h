@@ -0,0 +1,11 @@
+// Aggregates the inverse trig data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Intentionally NOT guarded with #ifndef: it pulls in the Highway
+// target-toggled header atan8-inl.h, which must be re-included once per SIMD
+// target, see npsr/trig/data/data.h. The include-once children (asin/atan)
+// carry their own guards and no-op on re-entry.
+#include "npsr/lut-inl.h"
+#include "npsr/invtrig/data/asin.h"
+#include "npsr/invtrig/data/atan.h"
+#include "npsr/invtrig/data/atan8-inl.h"
@@ -0,0 +1,361 @@
+// Inverse trigonometric function dispatcher for Highway SIMD library
+// This file provides the public API for arcsine, arccosine, arctangent and
+// the two-argument arctangent with configurable precision and special case
+// handling
+//
+// Each function selects between two tiers of its kernel:
+// 1. Low precision: ~2 ULP error, plain reconstruction
+// 2. High precision: < 1 ULP error, compensated reconstruction
+
+#if defined(NPSR_INVTRIG_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_INVTRIG_INL_H_
+#undef NPSR_INVTRIG_INL_H_
+#else
+#define NPSR_INVTRIG_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/invtrig/asin-inl.h"  // Arcsine and arccosine kernel
+#include "npsr/invtrig/atan-inl.h"  // Table driven arctangent kernel
+#include "npsr/precise.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::invtrig {
+
+/**
+ * @brief Two-argument arctangent
+ *
+ * Folds (y, x) into p = min(|y|, |x|) ≤ q = max(|y|, |x|) and the octant
+ * bits for AtanKernel<>, which resolves the quadrant by table lookup, then
+ * applies the sign of y. No branch depends on the signs or on which
+ * argument is larger.
+ *
+ * - Subnormal q is scaled into the normal range first, exactly, and lanes
+ *   with q beyond 2^±60 (float) or 2^±500 (double) are then rescaled by a
+ *   power of two, so that q ∈ [2, 4) and the kernel neither overflows nor
+ *   loses bits to subnormals. Both happen in every mode, kNoLargeArgument
+ *   included, since skipping them gives NaN rather than a less accurate
+ *   result. The LargeArgument branch policy only decides whether the
+ *   rescaling is skipped for vectors without such lanes: kBranchy does,
+ *   kBranchless and kNeverExtended always blend it in at a fixed cost.
+ * - kSpecialCases: NaN propagates, signed zeros and infinities follow
+ *   IEEE 754, e.g. atan2(±0, -0) = ±π and atan2(±∞, -∞) = ±3π/4.
+ *
+ * No exception is raised, atan2 has none beyond inexact and underflow.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Atan2(Prec &prec, V y, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VU = Vec<RebindToUnsigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  (void)prec;
+
+  const V ay = Abs(y);
+  const V ax = Abs(x);
+  const auto swap = Gt(ay, ax);
+  V p = Min(ay, ax);
+  V q = Max(ay, ax);
+  auto octant = IfThenElseZero(RebindMask(di, swap), Set(di, 1));
+  octant = Or(octant, IfThenElseZero(RebindMask(di, IsNegative(x)), Set(di, 2)));
+
+  if constexpr (Prec::kSpecialCases) {
+    // Infinite and zero q reduce to the ratios 1, 0 and 0/1
+    const auto is_fix = Or(IsInf(q), Eq(q, Zero(d)));
+    p = IfThenElse(is_fix, IfThenElseZero(IsInf(p), Set(d, 1.0)), p);
+    q = IfThenElse(is_fix, Set(d, 1.0), q);
+  }
+  // Subnormal q is made normal first, exactly
+  const V pre = IfThenElse(Lt(q, Set(d, kIsSingle ? 0x1p-126f : 0x1p-1022)),
+                           Set(d, kIsSingle ? 0x1p24f : 0x1p53), Set(d, 1.0));
+  p = Mul(p, pre);
+  q = Mul(q, pre);
+  const auto is_extreme = Or(Gt(q, Set(d, kIsSingle ? 0x1p60f : 0x1p500)),
+                             Lt(q, Set(d, kIsSingle ? 0x1p-60f : 0x1p-500)));
+  if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_extreme))) {
+    // 2^(1 - e) for the exponent e of q, normal for every finite q, moves
+    // q into [2, 4) and p/q keeps all of its bits
+    constexpr auto kMaxBiased = (1u << hwy::ExponentBits<T>()) - 1;
+    const VU biased = Sub(Set(du, kMaxBiased), GetBiasedExponent(q));
+    V scale = BitCast(d, ShiftLeft<hwy::MantissaBits<T>()>(biased));
+    scale = IfThenElse(is_extreme, scale, Set(d, 1.0));
+    p = Mul(p, scale);
+    q = Mul(q, scale);
+  }
+  V ret = AtanKernel<Prec::kHighAccuracy>(p, q, octant);
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(Or(IsNaN(x), IsNaN(y)), NaN(d), ret);
+  }
+  return CopySignToAbs(ret, y);
+}
+
+/// Arctangent, atan2(x, 1) folded into p = min(|x|, 1), q = max(|x|, 1).
+template <typename Prec, typename V>
+NPSR_INTRIN V Atan(Prec &prec, V x) {
+  using namespace hn;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, 1.0);
+  (void)prec;
+
+  const V a = Abs(x);
+  V p = Min(a, one);
+  V q = Max(a, one);
+  const auto octant =
+      IfThenElseZero(RebindMask(di, Gt(a, one)), Set(di, 1));
+  if constexpr (Prec::kSpecialCases) {
+    // atan(±∞) = ±π/2
+    const auto is_inf = IsInf(q);
+    p = IfThenElseZero(Not(is_inf), p);
+    q = IfThenElse(is_inf, one, q);
+  }
+  V ret = AtanKernel<Prec::kHighAccuracy>(p, q, octant);
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(IsNaN(x), x, ret);
+  }
+  return CopySignToAbs(ret, x);
+}
+
+/**
+ * @brief Unified inverse trigonometric implementation
+ *
+ * @tparam OP       Operation type: kAsin, kAcos or kAtan
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * Inputs of asin and acos are bounded, so kLargeArgument and the branch
+ * policy tags have no effect. Lanes with |x| > 1 give NaN and raise
+ * invalid; with kNoSpecialCases their value is unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V InvTrig(Prec &prec, V x) {
+  using namespace hn;
+  if constexpr (OP == Operation::kAtan) {
+    return Atan(prec, x);
+  } else {
+    const DFromV<V> d;
+    V ret = AsinAcos<OP, Prec::kHighAccuracy>(x);
+    const auto is_domain_err = Gt(Abs(x), Set(d, 1.0));
+    if constexpr (Prec::kSpecialCases) {
+      // IEEE 754 requires: asin(x) = acos(x) = NaN for |x| > 1
+      ret = IfThenElse(is_domain_err, NaN(d), ret);
+    }
+    if constexpr (Prec::kExceptions) {
+      prec.Raise(!AllFalse(d, is_domain_err) ? FPExceptions::kInvalid : 0);
+    }
+    return ret;
+  }
+}
+
+/**
+ * @brief Applies InvTrig over a contiguous array.
+ *
+ * The remainder is handled with a partial load/store, whose zero padding
+ * never raises.
+ */
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void InvTrigArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(InvTrig<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(InvTrig<OP>(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+/// Applies Atan2 over two contiguous arrays, see InvTrigArray.
+template <typename Prec, typename T>
+NPSR_INTRIN void Atan2Array(Prec &prec, const T *y, const T *x, size_t count,
+                            T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Atan2(prec, LoadU(d, y + i), LoadU(d, x + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(Atan2(prec, LoadN(d, y + i, remaining), LoadN(d, x + i, remaining)),
+           d, out + i, remaining);
+  }
+}
+
+/**
+ * @brief Phase of interleaved complex numbers, atan2(im, re)
+ *
+ * Full vectors are split into real and imaginary parts by LoadInterleaved2.
+ * The remainder loads up to two partial vectors and deinterleaves them with
+ * ConcatEven/ConcatOdd; its zero padding never raises.
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void ArgArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  using V = Vec<ScalableTag<T>>;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    V re, im;
+    LoadInterleaved2(d, in + 2 * i, re, im);
+    StoreU(Atan2(prec, im, re), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    const size_t scalars = 2 * remaining;
+    const V v0 = LoadN(d, in + 2 * i, scalars);
+    const V v1 = LoadN(d, in + 2 * i + N, scalars > N ? scalars - N : 0);
+    StoreN(Atan2(prec, ConcatOdd(d, v1, v0), ConcatEven(d, v1, v0)), d,
+           out + i, remaining);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::invtrig
+
+// Public API in the main npsr namespace
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Compute arcsine of vector elements with configurable precision
+ *
+ * Error: ~0.75 ULP by default (~1.2 ULP without native FMA), ~2 ULP with
+ * kLowAccuracy.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       asin(x) for each element, in [-π/2, π/2]
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoExceptions, kNoSpecialCases};
+ * auto result = Asin(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Asin(Prec &prec, V x) {
+  return invtrig::InvTrig<invtrig::Operation::kAsin>(prec, x);
+}
+
+/**
+ * @brief Compute arccosine of vector elements with configurable precision
+ *
+ * Same kernel and error bounds as Asin.
+ *
+ * @return       acos(x) for each element, in [0, π]
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Acos(Prec &prec, V x) {
+  return invtrig::InvTrig<invtrig::Operation::kAcos>(prec, x);
+}
+
+/**
+ * @brief Compute arcsine over an array
+ *
+ * @param prec   Precise object managing FP environment
+ * @param in     Input array of `count` elements
+ * @param count  Number of elements
+ * @param out    Output array, may be `in` itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Asin(Prec &prec, const T *in, size_t count, T *out) {
+  invtrig::InvTrigArray<invtrig::Operation::kAsin>(prec, in, count, out);
+}
+
+/// Compute arccosine over an array, see the array overload of Asin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Acos(Prec &prec, const T *in, size_t count, T *out) {
+  invtrig::InvTrigArray<invtrig::Operation::kAcos>(prec, in, count, out);
+}
+
+/**
+ * @brief Compute arctangent of vector elements with configurable precision
+ *
+ * Reduces against a table of atan(j/8) loaded through Lut, then evaluates a
+ * short minimax polynomial. Error: ~0.5 ULP by default (~1.4 ULP without
+ * native FMA), ~2 ULP with kLowAccuracy.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       atan(x) for each element, in [-π/2, π/2]
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Atan(Prec &prec, V x) {
+  return invtrig::Atan(prec, x);
+}
+
+/**
+ * @brief Compute the two-argument arctangent of vector elements
+ *
+ * Same kernel and error bounds as Atan; quadrant and sign are resolved by
+ * the table index, without branches. Arguments of extreme magnitude,
+ * subnormals included, keep full accuracy in every mode, see
+ * invtrig::Atan2.
+ *
+ * @param prec   Precise object managing FP environment
+ * @param y      Ordinate vector
+ * @param x      Abscissa vector
+ * @return       atan2(y, x) for each element, in [-π, π]
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, LargeArgument::kBranchless};
+ * auto phase = Atan2(prec, imag, real);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Atan2(Prec &prec, V y, V x) {
+  return invtrig::Atan2(prec, y, x);
+}
+
+/// Compute arctangent over an array, see the array overload of Asin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Atan(Prec &prec, const T *in, size_t count, T *out) {
+  invtrig::InvTrigArray<invtrig::Operation::kAtan>(prec, in, count, out);
+}
+
+/// Compute atan2(y[i], x[i]) over two arrays, see the array overload of Asin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Atan2(Prec &prec, const T *y, const T *x, size_t count,
+                       T *out) {
+  invtrig::Atan2Array(prec, y, x, count, out);
+}
+
+/**
+ * @brief Compute the phase of interleaved complex numbers
+ *
+ * The equivalent of np.angle over complex64 (T = float) or complex128
+ * (T = double) data: `in` holds `count` (real, imaginary) pairs and
+ * out[i] = atan2(in[2i + 1], in[2i]), without deinterleaving into
+ * temporary buffers first. `out` may be `in` itself, the phases then fill
+ * its first `count` elements.
+ *
+ * @example
+ * ```cpp
+ * std::complex<float> spectrum[n];
+ * Arg(prec, reinterpret_cast<const float *>(spectrum), n, phase);
+ * ```
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Arg(Prec &prec, const T *in, size_t count, T *out) {
+  invtrig::ArgArray(prec, in, count, out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_INVTRIG_INL_H_
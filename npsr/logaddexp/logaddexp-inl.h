@@ -0,0 +1,201 @@
+#if defined(NPSR_LOGADDEXP_LOGADDEXP_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_LOGADDEXP_LOGADDEXP_INL_H_
+#undef NPSR_LOGADDEXP_LOGADDEXP_INL_H_
+#else
+#define NPSR_LOGADDEXP_LOGADDEXP_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"               // TwoSum, TwoProd
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReducedDW, Pow2I
+#include "npsr/exponential/inl.h"      // kInputBound
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // LogKernel, LogKernelDW
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::logaddexp {
+
+// Operation type of the logaddexp kernels
+enum class Operation { kLogAddExp = 0, kLogAddExp2 = 1 };
+
+// Exponential of the base of OP
+template <Operation OP>
+inline constexpr exponential::Operation kExpOp =
+    OP == Operation::kLogAddExp ? exponential::Operation::kExp
+                                : exponential::Operation::kExp2;
+
+/**
+ * This function computes e^t or 2^t (OP) of t ≤ 0, clamped to the lower
+ * bound of the exponential, whose results already round to zero.
+ *
+ * The reduction yields 2^m·y ≤ 1, and 2^m is applied as two normal powers
+ * of two, see exponential::Ldexp<>, so results below the normal range are
+ * correctly rounded subnormals. With kHigh, t + t_lo is taken as a
+ * double-word: y comes from the table as one too, the low parts of the
+ * reduction joining its tail as y·r_lo, and lo holds its scaled low part.
+ * Otherwise y comes from the polynomial over |r| ≤ ln2/2, t_lo is ignored
+ * and lo is zero.
+ */
+template <exponential::Operation OP, bool kHigh, typename V>
+NPSR_INTRIN V ExpNonPositive(V t, V t_lo, V &lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+
+  const V bound = Set(d, exponential::kInputBound<OP, T>[0]);
+  // Past the bound t_lo may be NaN, from a difference that overflowed
+  t_lo = IfThenElseZero(Gt(t, bound), t_lo);
+  t = Max(t, bound);
+  V r_hi, r_lo;
+  VI m;
+  VI k = exponential::Reduce<OP, kHigh>(t, r_hi, r_lo);
+  V y;
+  if constexpr (kHigh) {
+    // r is in units of ln(e), base 2 scales t_lo by ln2
+    const V scale = Set(d, OP == exponential::Operation::kExp2
+                               ? ::npsr::exponential::data::kLn2<T>[0]
+                               : static_cast<T>(1.0));
+    r_lo = MulAdd(t_lo, scale, r_lo);
+    y = exponential::ExpReducedDW(k, r_hi, m, lo);
+    lo = MulAdd(y, r_lo, lo);
+  } else {
+    (void)t_lo;
+    y = exponential::ExpReduced<false>(k, Add(r_hi, r_lo), m);
+    lo = Zero(d);
+  }
+  VI m1 = ShiftRight<1>(m);
+  const V p1 = exponential::Pow2I(d, m1);
+  const V p2 = exponential::Pow2I(d, Sub(m, m1));
+  if constexpr (kHigh) {
+    lo = Mul(Mul(lo, p1), p2);
+  }
+  return Mul(Mul(y, p1), p2);
+}
+
+/**
+ * This function computes log(e^x + e^y) or log2(2^x + 2^y) (OP) of finite
+ * x and y.
+ *
+ * Algorithm Overview:
+ * 1. Factoring: with M = max(x, y) and t = min(x, y) - M, the result is
+ *    M + log(1 + e^t), so the exponential never overflows and its argument
+ *    is at most 0, see ExpNonPositive<>
+ *
+ * 2. Logarithm: s = 1 + e^t by fast two-sum, e^t ≤ 1, its rounding error
+ *    carried into the log1p form of logarithm::LogKernel<>. Base 2 scales
+ *    the natural logarithm by 1/ln2
+ *
+ * 3. Result: M + log(s), the lone rounding of a sum of two terms
+ *
+ * With kHigh, t and e^t are double-words and log(s) comes from
+ * logarithm::LogKernelDW<> with the low part of s added as s_lo/s, then
+ * scaled by 1/ln2 as a double-word product for base 2. M + log(s) is an
+ * exact two-sum, as neither term dominates, so the result rounds once,
+ * ~0.5 ULP error, or ~2^-60 absolute where the two terms cancel around
+ * e^x + e^y = 1. Float widens to the double low tier instead. Otherwise
+ * every step rounds, ~2.5 ULP error.
+ */
+template <Operation OP, bool kHigh, typename V>
+NPSR_INTRIN V LogAddExpKernel(V x, V y) {
+  using namespace hn;
+  namespace data = ::npsr::logarithm::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  if constexpr (kHigh && std::is_same_v<T, float>) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, LogAddExpKernel<OP, false>(PromoteLowerTo(dw, x),
+                                                      PromoteLowerTo(dw, y)));
+    auto up = DemoteTo(dh, LogAddExpKernel<OP, false>(PromoteUpperTo(dw, x),
+                                                      PromoteUpperTo(dw, y)));
+    return Combine(d, up, lo);
+  } else {
+    const V hi = Max(x, y);
+    const V lo = Min(x, y);
+    // lo - hi by two-sum, its error matters where the result cancels
+    V t;
+    V t_lo = Zero(d);
+    if constexpr (kHigh) {
+      t = TwoSum(lo, Neg(hi), t_lo);
+    } else {
+      t = Sub(lo, hi);
+    }
+    V e_lo;
+    V e = ExpNonPositive<kExpOp<OP>, kHigh>(t, t_lo, e_lo);
+    V s = Add(one, e);
+    V s_lo = Add(Sub(one, s), e);
+    if constexpr (kHigh) {
+      V l_lo;
+      V l_hi = logarithm::LogKernelDW(s, Zero(di), l_lo);
+      l_lo = Add(l_lo, Div(Add(s_lo, e_lo), s));
+      if constexpr (OP == Operation::kLogAddExp2) {
+        constexpr auto kB = data::kInvLn2<T>;
+        V p_lo;
+        V p_hi = TwoProd(l_hi, Set(d, kB[0]), p_lo);
+        l_lo = MulAdd(l_hi, Set(d, kB[1]), MulAdd(l_lo, Set(d, kB[0]), p_lo));
+        l_hi = p_hi;
+      }
+      V err;
+      V sum = TwoSum(hi, l_hi, err);
+      return Add(sum, Add(err, l_lo));
+    } else {
+      V l = logarithm::LogKernel<logarithm::Operation::kLog1p, false>(
+          s, s_lo, Zero(di));
+      if constexpr (OP == Operation::kLogAddExp2) {
+        l = Mul(l, Set(d, data::kInvLn2<T>[0]));
+      }
+      return Add(hi, l);
+    }
+  }
+}
+
+/**
+ * This function adds e^x to the running sum of each lane, kept as
+ * e^max·(sum + comp) so nothing overflows, in a single pass.
+ *
+ * Only one exponential per element: with t = -|x - max|, a larger x
+ * rescales the sum by e^t and adds 1, any other x adds e^t. Equal x and max
+ * leave t = 0, infinities of the same sign included, whose difference is
+ * NaN. With kHigh, e^t comes from the table as a double-word and the
+ * rounding of every product and addition is carried in comp by TwoProd and
+ * two-sums, so the sum of n terms errs by ~2^-digits instead of
+ * ~n·2^-digits. Otherwise comp stays zero.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN void LogSumExpStep(V x, V &max, V &sum, V &comp) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+
+  const auto is_new = Gt(x, max);
+  V t = IfThenElseZero(Ne(x, max), Neg(Abs(Sub(x, max))));
+  V e_lo;
+  V e = ExpNonPositive<exponential::Operation::kExp, kHigh>(t, Zero(d), e_lo);
+  V a = IfThenElse(is_new, Set(d, static_cast<T>(1.0)), e);
+  if constexpr (kHigh) {
+    // (sum + comp)·(e + e_lo) with the rounding of sum·e kept in comp
+    V p_lo;
+    V p = TwoProd(sum, e, p_lo);
+    V scaled = MulAdd(comp, e, MulAdd(sum, e_lo, p_lo));
+    sum = IfThenElse(is_new, p, sum);
+    comp = IfThenElse(is_new, scaled, Add(comp, e_lo));
+    V s_lo;
+    sum = TwoSum(sum, a, s_lo);
+    comp = Add(comp, s_lo);
+  } else {
+    (void)comp;
+    sum = Add(IfThenElse(is_new, Mul(sum, e), sum), a);
+  }
+  max = Max(max, x);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::logaddexp
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_LOGADDEXP_LOGADDEXP_INL_H_
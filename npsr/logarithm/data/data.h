@@ -0,0 +1,10 @@
+// Aggregates the logarithm data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Intentionally NOT guarded with #ifndef: it pulls in the Highway
+// target-toggled header logc-inl.h, which must be re-included once per SIMD
+// target, see npsr/trig/data/data.h. The include-once child (log) carries its
+// own guard and no-ops on re-entry.
+#include "npsr/lut-inl.h"
+#include "npsr/logarithm/data/log.h"
+#include "npsr/logarithm/data/logc-inl.h"
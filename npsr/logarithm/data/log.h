@@ -0,0 +1,77 @@
+// Auto-generated by npsr/logarithm/data/log.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_LOGARITHM_DATA_LOG_H
+#define NPSR_LOGARITHM_DATA_LOG_H
+
+namespace npsr::logarithm::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kLogPoly[] = {};
+// log1p degree 5, |r| < 2^-5.5, relative error 2^-32.5
+template <> inline constexpr float kLogPoly<float>[] = {
+0x1.99b33p-3f, -0x1.001518p-2f, 0x1.555556p-2f, -0x1p-1f, 
+};
+// log1p degree 9, |r| < 2^-5.5, relative error 2^-60.5
+template <> inline constexpr double kLogPoly<double>[] = {
+0x1.c76c639c3d9d1p-4, -0x1.003b7a9cd2dcp-3, 0x1.2492478af59cp-3, -0x1.55554f961eeb6p-3, 
+0x1.999999998754bp-3, -0x1.000000001a364p-2, 0x1.555555555555bp-2, -0x1.ffffffffffffcp-2, 
+};
+
+template <typename T> inline constexpr char kLogPowPoly[] = {};
+// log1p degree 6 past r - r²/2, |r| < 2^-5.5, relative error 2^-39.75
+template <> inline constexpr float kLogPowPoly<float>[] = {
+-0x1.558518p-3f, 0x1.99d4dcp-3f, -0x1.fffffep-3f, 0x1.555554p-2f, 
+};
+// log1p degree 10 past r - r²/2, |r| < 2^-5.5, relative error 2^-67
+template <> inline constexpr double kLogPowPoly<double>[] = {
+-0x1.99fdbf3bbdf9fp-4, 0x1.c78d6c5daa289p-4, -0x1.fffff5b151135p-4, 0x1.2492433ff514dp-3, 
+-0x1.555555558e0f1p-3, 0x1.99999999d78c5p-3, -0x1.ffffffffffff2p-3, 0x1.555555555554fp-2, 
+};
+
+template <typename T> inline constexpr char kLogLowPoly[] = {};
+// R(w) degree 3, w = s² < 0.0332, relative error 2^-21.25
+template <> inline constexpr float kLogLowPoly<float>[] = {
+0x1.300b14p-2f, 0x1.99762cp-2f, 0x1.55555cp-1f, };
+// R(w) degree 7, w = s² < 0.0332, relative error 2^-49.75
+template <> inline constexpr double kLogLowPoly<double>[] = {
+0x1.2eab7bc99702ap-3, 0x1.39b602562db2bp-3, 0x1.7464fc0f65491p-3, 0x1.c71c5a9634598p-3, 
+0x1.2492493490027p-2, 0x1.9999999991a69p-2, 0x1.5555555555559p-1, };
+
+template <typename T> inline constexpr char kLn2[] = {};
+template <> inline constexpr float kLn2<float>[] = {
+0x1.63p-1f, -0x1.bd0106p-13f, };
+template <> inline constexpr double kLn2<double>[] = {
+0x1.62e42fefap-1, 0x1.cf79abc9e3b3ap-40, };
+
+template <typename T> inline constexpr char kLog10Of2[] = {};
+template <> inline constexpr float kLog10Of2<float>[] = {
+0x1.344p-2f, 0x1.3509f8p-18f, };
+template <> inline constexpr double kLog10Of2<double>[] = {
+0x1.34413509fp-2, 0x1.e7fbcc47c4acdp-40, };
+
+template <typename T> inline constexpr char kInvLn2[] = {};
+template <> inline constexpr float kInvLn2<float>[] = {
+0x1.715476p0f, 0x1.4ae0cp-26f, };
+template <> inline constexpr double kInvLn2<double>[] = {
+0x1.71547652b82fep0, 0x1.777d0ffda0d24p-56, };
+
+template <typename T> inline constexpr char kInvLn10[] = {};
+template <> inline constexpr float kInvLn10<float>[] = {
+0x1.bcb7b2p-2f, -0x1.5b235ep-27f, };
+template <> inline constexpr double kInvLn10<double>[] = {
+0x1.bcb7b1526e50ep-2, 0x1.95355baaafad3p-57, };
+
+template <typename T> inline constexpr char kInvLn2Split[] = {};
+template <> inline constexpr float kInvLn2Split<float>[] = {
+0x1.716p0f, -0x1.7135a8p-13f, };
+template <> inline constexpr double kInvLn2Split<double>[] = {
+0x1.7154768p0, -0x1.6a3e80f444178p-27, };
+
+template <typename T> inline constexpr char kInvLn10Split[] = {};
+template <> inline constexpr float kInvLn10Split<float>[] = {
+0x1.bccp-2f, -0x1.09d5b2p-15f, };
+template <> inline constexpr double kInvLn10Split<double>[] = {
+0x1.bcb7b18p-2, -0x1.6c8d78e6acaa4p-29, };
+
+} // namespace npsr::logarithm::data
+
+#endif // NPSR_LOGARITHM_DATA_LOG_H
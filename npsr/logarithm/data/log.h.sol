@@ -0,0 +1,153 @@
+// Generates the minimax polynomials and constants of the logarithm kernels
+// (see npsr/logarithm/log-inl.h).
+//
+// The input is split as x = 2^k·z with z ∈ [kLogOffset, 2·kLogOffset),
+// kLogOffset = 0x1.628p-1, so z straddles 1 and |log(z)| stays small.
+//
+// The table driven tier further writes z = c·(1 + r) with 1/c loaded from
+// npsr/logarithm/data/logc-inl.h, which bounds |r| < 2^-5.5:
+//   log(1 + r) ≈ r + r²·P(r)
+//
+// Pow needs log(x) well past the precision of T, so its double-word kernel
+// keeps r - r²/2 exact and only evaluates the rest:
+//   log(1 + r) ≈ r - r²/2 + r³·S(r)
+//
+// The table-free tier uses s = f/(2 + f), f = z - 1, and
+//   log(1 + f) = f - (f²/2 - s·(f²/2 + R)),  R = 2·atanh(s)/s - 2 ≈ w·Q(w)
+// with w = s², the fdlibm formulation, which keeps f exact up front.
+//
+// Parameters:
+//   pName - Name of the C++ array
+//   pT    - Type descriptor (Float32 or Float64)
+//   pDeg  - Degree of the polynomial
+procedure Log_(pName, pT, pDeg) {
+  var i, $;
+  $.range = [-2^-5.5; 2^-5.5];
+  $.monos = [||];
+  for i from 2 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.log = MinimaxCoeffs(pT, log1p(x), $.monos, $.range, x);
+  $.array = CArrayT(pT, $.log.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// log1p degree " @ pDeg @ ", |r| < 2^-5.5" @
+    ", relative error 2^" @ round(log2($.log.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " " @ pName @ "<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+procedure LogPow_(pName, pT, pDeg) {
+  var i, $;
+  $.range = [-2^-5.5; 2^-5.5];
+  $.monos = [||];
+  for i from 3 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.log = MinimaxCoeffs(pT, log1p(x), $.monos, $.range, x - x^2 / 2);
+  $.array = CArrayT(pT, $.log.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// log1p degree " @ pDeg @ " past r - r²/2, |r| < 2^-5.5" @
+    ", relative error 2^" @ round(log2($.log.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " " @ pName @ "<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+procedure LogLow_(pName, pT, pDeg) {
+  var i, $;
+  $.offset = 0x1.628p-1;
+  $.wmax = (($.offset - 1) / ($.offset + 1))^2 * (1 + 2^-10);
+  $.range = [2^-60; $.wmax];
+  $.monos = [||];
+  for i from 1 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.r = MinimaxCoeffs(pT, 2 * atanh(sqrt(x)) / sqrt(x) - 2, $.monos,
+                      $.range, 0);
+  $.array = CArrayT(pT, $.r.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// R(w) degree " @ pDeg @ ", w = s² < 0.0332" @
+    ", relative error 2^" @ round(log2($.r.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " " @ pName @ "<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kLogPoly[] = {};"
+);
+Append @ Log_("kLogPoly", Float32, 5);
+Append @ Log_("kLogPoly", Float64, 9);
+Append(
+  "",
+  "template <typename T> inline constexpr char kLogPowPoly[] = {};"
+);
+Append @ LogPow_("kLogPowPoly", Float32, 6);
+Append @ LogPow_("kLogPowPoly", Float64, 10);
+Append(
+  "",
+  "template <typename T> inline constexpr char kLogLowPoly[] = {};"
+);
+Append @ LogLow_("kLogLowPoly", Float32, 3);
+Append @ LogLow_("kLogLowPoly", Float64, 7);
+
+// k·C for the exponent k, C = log_b(2). The heads leave room for the largest
+// |k|, 2^8 (float) and 2^11 (double) once subnormal inputs are prescaled, so
+// k·C₁ is exact.
+// The full precision pairs 1/ln(b) convert the natural logarithm of z. Without
+// native FMA the conversion uses the split pairs, whose heads hold half the
+// digits so the product with a half-width operand is exact.
+Append(
+  "",
+  "template <typename T> inline constexpr char kLn2[] = {};",
+  "template <> inline constexpr float kLn2<float>[] = " @
+  CArrayT(Float32, Constants(log(2), [|RN, 11, 24|]), 4) @ ";",
+  "template <> inline constexpr double kLn2<double>[] = " @
+  CArrayT(Float64, Constants(log(2), [|RN, 37, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kLog10Of2[] = {};",
+  "template <> inline constexpr float kLog10Of2<float>[] = " @
+  CArrayT(Float32, Constants(log10(2), [|RN, 11, 24|]), 4) @ ";",
+  "template <> inline constexpr double kLog10Of2<double>[] = " @
+  CArrayT(Float64, Constants(log10(2), [|RN, 37, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kInvLn2[] = {};",
+  "template <> inline constexpr float kInvLn2<float>[] = " @
+  CArrayT(Float32, Constants(1 / log(2), [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kInvLn2<double>[] = " @
+  CArrayT(Float64, Constants(1 / log(2), [|RN, 53, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kInvLn10[] = {};",
+  "template <> inline constexpr float kInvLn10<float>[] = " @
+  CArrayT(Float32, Constants(1 / log(10), [|RN, 24, 24|]), 4) @ ";",
+  "template <> inline constexpr double kInvLn10<double>[] = " @
+  CArrayT(Float64, Constants(1 / log(10), [|RN, 53, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kInvLn2Split[] = {};",
+  "template <> inline constexpr float kInvLn2Split<float>[] = " @
+  CArrayT(Float32, Constants(1 / log(2), [|RN, 12, 24|]), 4) @ ";",
+  "template <> inline constexpr double kInvLn2Split<double>[] = " @
+  CArrayT(Float64, Constants(1 / log(2), [|RN, 26, 53|]), 4) @ ";",
+  "",
+  "template <typename T> inline constexpr char kInvLn10Split[] = {};",
+  "template <> inline constexpr float kInvLn10Split<float>[] = " @
+  CArrayT(Float32, Constants(1 / log(10), [|RN, 12, 24|]), 4) @ ";",
+  "template <> inline constexpr double kInvLn10Split<double>[] = " @
+  CArrayT(Float64, Constants(1 / log(10), [|RN, 26, 53|]), 4) @ ";",
+  ""
+);
+
+WriteCPPHeader("npsr::logarithm::data");
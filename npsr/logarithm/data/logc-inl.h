@@ -0,0 +1,85 @@
+// Auto-generated by npsr/logarithm/data/logc-inl.h.sol
+// Use `spin sollya -f` to force regeneration
+#if defined(NPSR_LOGARITHM_DATA_LOGC_INL_H) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_LOGARITHM_DATA_LOGC_INL_H
+#undef NPSR_LOGARITHM_DATA_LOGC_INL_H
+#else
+#define NPSR_LOGARITHM_DATA_LOGC_INL_H
+#endif
+
+HWY_BEFORE_NAMESPACE();
+namespace npsr::HWY_NAMESPACE::logarithm {
+inline constexpr auto kLogTableF32 = MakeLut<float>(
+// 1/c, at most 7 significant bits
+{
+0x1.6cp0f, 0x1.64p0f, 0x1.6p0f, 0x1.58p0f, 
+0x1.5p0f, 0x1.48p0f, 0x1.44p0f, 0x1.3cp0f, 
+0x1.38p0f, 0x1.3p0f, 0x1.2cp0f, 0x1.24p0f, 
+0x1.2p0f, 0x1.1cp0f, 0x1.18p0f, 0x1.1p0f, 
+0x1.0cp0f, 0x1.08p0f, 0x1.04p0f, 0x1p0f, 
+0x1.fp-1f, 0x1.e8p-1f, 0x1.d8p-1f, 0x1.c8p-1f, 
+0x1.cp-1f, 0x1.bp-1f, 0x1.a8p-1f, 0x1.9cp-1f, 
+0x1.9p-1f, 0x1.88p-1f, 0x1.8p-1f, 0x1.78p-1f, 
+},
+// High parts of log(c)
+{
+-0x1.686c82p-2f, -0x1.51aad8p-2f, -0x1.4618bcp-2f, -0x1.2e8e2cp-2f, 
+-0x1.1675cap-2f, -0x1.fb9186p-3f, -0x1.e27076p-3f, -0x1.af3c94p-3f, 
+-0x1.9525aap-3f, -0x1.5ff308p-3f, -0x1.44d2b6p-3f, -0x1.0d77e8p-3f, 
+-0x1.e27076p-4f, -0x1.a926d4p-4f, -0x1.6f0d28p-4f, -0x1.f0a30cp-5f, 
+-0x1.77459p-5f, -0x1.f829bp-6f, -0x1.fc0a8cp-7f, 0.0f, 
+0x1.0415d8p-5f, 0x1.894aa2p-5f, 0x1.4d3116p-4f, 0x1.da7276p-4f, 
+0x1.1178e8p-3f, 0x1.5bf406p-3f, 0x1.823c16p-3f, 0x1.bd0874p-3f, 
+0x1.f991c6p-3f, 0x1.1178e8p-2f, 0x1.269622p-2f, 0x1.3c2528p-2f, 
+},
+// Low parts of log(c)
+{
+0x1.64eb52p-30f, -0x1.cb7e0cp-28f, -0x1.0e2f62p-29f, 0x1.47b8b4p-28f, 
+-0x1.7574c2p-27f, -0x1.abc7c6p-28f, -0x1.c55e5cp-28f, -0x1.d017fep-28f, 
+0x1.85d4a6p-30f, 0x1.eb0d86p-28f, -0x1.996fa4p-28f, 0x1.97b8d4p-30f, 
+-0x1.c55e5cp-29f, 0x1.6d4aa8p-30f, -0x1.5cad6ap-29f, -0x1.162a66p-37f, 
+0x1.39a46p-30f, -0x1.cf066p-31f, 0x1.e07f84p-32f, 0.0f, 
+0x1.3ce888p-30f, -0x1.6c0998p-30f, -0x1.6fc0aap-31f, 0x1.c22352p-31f, 
+0x1.13f23ep-30f, 0x1.6a87b6p-28f, 0x1.5468fp-29f, -0x1.f109d4p-29f, 
+0x1.96767p-28f, 0x1.13f23ep-29f, -0x1.d9648ep-27f, -0x1.1999dp-27f, 
+}
+);
+inline constexpr auto kLogTableF64 = MakeLut<double>(
+// 1/c, at most 7 significant bits
+{
+0x1.6cp0, 0x1.64p0, 0x1.6p0, 0x1.58p0, 
+0x1.5p0, 0x1.48p0, 0x1.44p0, 0x1.3cp0, 
+0x1.38p0, 0x1.3p0, 0x1.2cp0, 0x1.24p0, 
+0x1.2p0, 0x1.1cp0, 0x1.18p0, 0x1.1p0, 
+0x1.0cp0, 0x1.08p0, 0x1.04p0, 0x1p0, 
+0x1.fp-1, 0x1.e8p-1, 0x1.d8p-1, 0x1.c8p-1, 
+0x1.cp-1, 0x1.bp-1, 0x1.a8p-1, 0x1.9cp-1, 
+0x1.9p-1, 0x1.88p-1, 0x1.8p-1, 0x1.78p-1, 
+},
+// High parts of log(c)
+{
+-0x1.686c81e9b14afp-2, -0x1.51aad872df82dp-2, -0x1.4618bc21c5ec2p-2, -0x1.2e8e2bae11d31p-2, 
+-0x1.1675cababa60ep-2, -0x1.fb9186d5e3e2bp-3, -0x1.e27076e2af2e6p-3, -0x1.af3c94e80bff3p-3, 
+-0x1.9525a9cf456b4p-3, -0x1.5ff3070a793d4p-3, -0x1.44d2b6ccb7d1ep-3, -0x1.0d77e7cd08e59p-3, 
+-0x1.e27076e2af2e6p-4, -0x1.a926d3a4ad563p-4, -0x1.6f0d28ae56b4cp-4, -0x1.f0a30c01162a6p-5, 
+-0x1.77458f632dcfcp-5, -0x1.f829b0e7833p-6, -0x1.fc0a8b0fc03e4p-7, 0.0, 
+0x1.0415d89e74444p-5, 0x1.894aa149fb343p-5, 0x1.4d3115d207eacp-4, 0x1.da727638446a2p-4, 
+0x1.1178e8227e47cp-3, 0x1.5bf406b543db2p-3, 0x1.823c16551a3c2p-3, 0x1.bd087383bd8adp-3, 
+0x1.f991c6cb3b379p-3, 0x1.1178e8227e47cp-2, 0x1.269621134db92p-2, 0x1.3c25277333184p-2, 
+},
+// Low parts of log(c)
+{
+0x1.ddea0f7f58e3dp-57, -0x1.3927ac19f55e3p-59, -0x1.f42decdeccf1dp-56, 0x1.8f4cdb95ebdf9p-56, 
+-0x1.ce63eab883717p-61, 0x1.caaae64f21acbp-57, 0x1.61578001e0162p-59, 0x1.398cff3641985p-58, 
+-0x1.d904c1d4e2e26p-57, 0x1.bc60efafc6f6ep-58, -0x1.9f4f6543e1f88p-57, -0x1.9a5dc5e9030acp-57, 
+0x1.61578001e0162p-60, -0x1.942f48aa70ea9p-58, 0x1.906d99184b992p-58, -0x1.85f325c5bbacdp-59, 
+-0x1.18d3ca87b9296p-59, -0x1.33e3f04f1ef23p-60, 0x1.83092c59642a1p-62, 0.0, 
+0x1.c05cf1d753622p-59, 0x1.a8be97660a23dp-60, 0x1.769f42c7842ccp-58, 0x1.401fa71733019p-58, 
+-0x1.0e63a5f01c691p-58, -0x1.1f5b44c0df7e7p-61, -0x1.1232ce70be781p-57, 0x1.dd355f6a516d7p-60, 
+0x1.f665066f980a2p-57, -0x1.0e63a5f01c691p-57, 0x1.e0efadd9db02bp-56, -0x1.2ad27e50a8ec6p-56, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_LOGARITHM_DATA_LOGC_INL_H(){}
+} // namespace npsr::HWY_NAMESPACE::logarithm
+HWY_AFTER_NAMESPACE();
+#endif // NPSR_LOGARITHM_DATA_LOGC_INL_H
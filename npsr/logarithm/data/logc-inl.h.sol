@@ -0,0 +1,72 @@
+// Generates the lookup table of the logarithm kernels
+// (see npsr/logarithm/log-inl.h).
+//
+// z ∈ [kLogOffset, 2·kLogOffset) is split into 32 intervals by the top five
+// mantissa bits of bits(z) - bits(kLogOffset). Each interval gets 1/c close to
+// the reciprocal of its midpoint, rounded to 7 significant bits, or 6 where
+// 7 would not keep |z/c - 1| < 2^-(bits - 1). z·(1/c) then holds at most
+// digits + bits - 1 bits and r = z·(1/c) - 1 is exact. The interval holding
+// 1 uses c = 1, so log(x) = r there without any cancellation.
+// log(c) = -log(1/c) is loaded as high and low parts.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pRow - 0 for 1/c, 1 for the high parts of log(c), 2 for the low parts
+// z at the fraction u of the bit range [bits(kLogOffset), bits(2·kLogOffset)),
+// whose mantissa steps are twice as large once z passes 1
+procedure LogZ_(pU) {
+  var $;
+  $.offset = 0x1.628p-1;
+  $.u1 = 2 * (1 - $.offset);
+  return (if (pU <= $.u1) then $.offset + pU / 2 else 1 + (pU - $.u1));
+};
+
+procedure LogTable_(pT, pRow) {
+  var r, i, b, $;
+  r = [||];
+  for i from 0 to 31 do {
+    $.z0 = LogZ_(i / 32);
+    $.z1 = LogZ_((i + 1) / 32);
+    if ($.z0 <= 1 && 1 < $.z1) then {
+      $.inv = 1;
+    } else {
+      b = 7;
+      $.inv = round(2 / ($.z0 + $.z1), b, RN);
+      if (max(abs($.z0 * $.inv - 1), abs($.z1 * $.inv - 1)) >= 2^-(b - 1)) then {
+        b = 6;
+        $.inv = round(2 / ($.z0 + $.z1), b, RN);
+      };
+    };
+    $.logc = -log($.inv);
+    $.hi = pT.kRound($.logc);
+    if (pRow == 0) then {
+      r = r :. $.inv;
+    } else if (pRow == 1) then {
+      r = r :. $.hi;
+    } else {
+      r = r :. pT.kRound($.logc - $.hi);
+    };
+  };
+  return CArrayT(pT, r, 4);
+};
+
+Append(
+  "inline constexpr auto kLogTableF32 = MakeLut<float>(",
+  "// 1/c, at most 7 significant bits",
+  LogTable_(Float32, 0) @ ",",
+  "// High parts of log(c)",
+  LogTable_(Float32, 1) @ ",",
+  "// Low parts of log(c)",
+  LogTable_(Float32, 2),
+  ");",
+  "inline constexpr auto kLogTableF64 = MakeLut<double>(",
+  "// 1/c, at most 7 significant bits",
+  LogTable_(Float64, 0) @ ",",
+  "// High parts of log(c)",
+  LogTable_(Float64, 1) @ ",",
+  "// Low parts of log(c)",
+  LogTable_(Float64, 2),
+  ");"
+);
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::logarithm");
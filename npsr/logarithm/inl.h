@@ -0,0 +1,235 @@
+// Logarithm function dispatcher for Highway SIMD library
+// This file provides the public API for log(x), log2(x), log10(x) and
+// log(1 + x) with configurable precision, special case handling and
+// subnormal mode
+//
+// Each function selects between two tiers of its kernel:
+// 1. Low precision: ~1-2.5 ULP error, fdlibm's s = f/(2 + f) form, no lookup
+// 2. High precision: ~0.55 ULP error, 1/c table with a short polynomial
+
+#if defined(NPSR_LOGARITHM_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_LOGARITHM_INL_H_
+#undef NPSR_LOGARITHM_INL_H_
+#else
+#define NPSR_LOGARITHM_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/dw-inl.h"  // TwoSum
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // Table driven logarithm kernels
+#include "npsr/precise.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::logarithm {
+
+/**
+ * @brief Unified logarithm implementation
+ *
+ * @tparam OP       Operation type: kLog, kLog2, kLog10 or kLog1p
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * The kernels read the exponent straight from the bits of x, which is only
+ * valid for positive normal x. With kSpecialCases:
+ * - Subnormal inputs are scaled into the normal range, their exponent
+ *   compensated, unless Subnormal::kDAZ, where they read as zero. The
+ *   LargeArgument branch policy decides whether the scaling is skipped for
+ *   vectors without such lanes. log1p needs no scaling, and its results
+ *   for subnormal x, which are x itself, flush to zero under
+ *   Subnormal::kFTZ.
+ * - Zero (-1 for log1p) gives -∞ and raises divide-by-zero, negative inputs
+ *   (below -1 for log1p) give NaN and raise invalid, unless kNoExceptions.
+ * - +∞ and NaN propagate, log1p(±0) returns ±0.
+ * With kNoSpecialCases, inputs must be positive normal (log1p: finite and
+ * greater than -1), others are unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V Logarithm(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  (void)prec;
+
+  V xr = x;
+  V x_lo = Zero(d);
+  VI k_adj = Zero(di);
+  if constexpr (OP == Operation::kLog1p) {
+    if constexpr (Prec::kSpecialCases && Prec::kDAZ) {
+      // Subnormal inputs read as zero of the same sign
+      const auto is_sub = Lt(Abs(x), Set(d, std::numeric_limits<T>::min()));
+      x = IfThenElse(is_sub, CopySignToAbs(Zero(d), x), x);
+    }
+    // 1 + x as a rounded sum and its error, log(u + c) ≈ log(u) + c/u
+    const V one = Set(d, static_cast<T>(1.0));
+    xr = TwoSum(x, one, x_lo);
+  } else if constexpr (Prec::kSpecialCases && !Prec::kDAZ) {
+    const auto is_sub =
+        And(Gt(x, Zero(d)), Lt(x, Set(d, std::numeric_limits<T>::min())));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_sub))) {
+      constexpr int kShift = hwy::MantissaBits<T>() + 1;
+      const V scale = Set(d, kIsSingle ? 0x1p24f : 0x1p53);
+      xr = IfThenElse(is_sub, Mul(x, scale), x);
+      k_adj = IfThenElseZero(RebindMask(di, is_sub), Set(di, -kShift));
+    }
+  }
+
+  V ret = LogKernel<OP, Prec::kHighAccuracy>(xr, x_lo, k_adj);
+
+  if constexpr (Prec::kSpecialCases) {
+    const V pole =
+        Set(d, static_cast<T>(OP == Operation::kLog1p ? -1.0 : 0.0));
+    auto is_pole = Eq(x, pole);
+    if constexpr (Prec::kDAZ && OP != Operation::kLog1p) {
+      // Subnormal inputs of either sign read as zero
+      is_pole = Lt(Abs(x), Set(d, std::numeric_limits<T>::min()));
+    }
+    const auto is_invalid = AndNot(is_pole, Lt(x, pole));
+    ret = IfThenElse(is_invalid, NaN(d), ret);
+    ret = IfThenElse(is_pole, Neg(Inf(d)), ret);
+    ret = IfThenElse(Or(IsNaN(x), Eq(x, Inf(d))), x, ret);
+    if constexpr (OP == Operation::kLog1p && Prec::kFTZ) {
+      const auto is_tiny =
+          Lt(Abs(ret), Set(d, std::numeric_limits<T>::min()));
+      ret = IfThenElse(is_tiny, CopySignToAbs(Zero(d), ret), ret);
+    }
+    if constexpr (OP == Operation::kLog1p) {
+      // Keeps log1p(-0) = -0
+      ret = IfThenElse(Eq(x, Zero(d)), x, ret);
+    }
+    if constexpr (Prec::kExceptions) {
+      int flags = !AllFalse(d, is_invalid) ? FPExceptions::kInvalid : 0;
+      flags |= !AllFalse(d, is_pole) ? FPExceptions::kDivByZero : 0;
+      prec.Raise(flags);
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Applies Logarithm over a contiguous array.
+ *
+ * The remainder is handled with a partial load/store, its padding is set to
+ * one so it never raises.
+ */
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void LogarithmArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Logarithm<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    const auto is_valid = FirstN(d, remaining);
+    const Vec<decltype(d)> x = IfThenElse(
+        is_valid, LoadN(d, in + i, remaining), Set(d, static_cast<T>(1.0)));
+    StoreN(Logarithm<OP>(prec, x), d, out + i, remaining);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::logarithm
+
+// Public API in the main npsr namespace
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Compute the natural logarithm of vector elements with configurable
+ * precision
+ *
+ * Splits off the exponent, reduces the mantissa against a table of 1/c
+ * loaded through Lut, then evaluates a short minimax polynomial of
+ * log(1 + r). Error: ~0.55 ULP by default, ~0.85 ULP with kLowAccuracy,
+ * which drops the table lookup for a division.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       log(x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoSpecialCases};
+ * auto result = Log(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Log(Prec &prec, V x) {
+  return logarithm::Logarithm<logarithm::Operation::kLog>(prec, x);
+}
+
+/**
+ * @brief Compute log2(x) of vector elements, same kernel as Log.
+ *
+ * Error: ~0.55 ULP by default, ~2.3 ULP with kLowAccuracy.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Log2(Prec &prec, V x) {
+  return logarithm::Logarithm<logarithm::Operation::kLog2>(prec, x);
+}
+
+/// Compute log10(x) of vector elements, same kernel and error bounds as Log2.
+template <typename Prec, typename V>
+NPSR_INTRIN V Log10(Prec &prec, V x) {
+  return logarithm::Logarithm<logarithm::Operation::kLog10>(prec, x);
+}
+
+/**
+ * @brief Compute log(1 + x) of vector elements with configurable precision
+ *
+ * Accurate for tiny x, where log(1 + x) would lose the low bits of x. The
+ * rounding error of 1 + x is carried into the kernel, same error bounds as
+ * Log.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Log1p(Prec &prec, V x) {
+  return logarithm::Logarithm<logarithm::Operation::kLog1p>(prec, x);
+}
+
+/**
+ * @brief Compute the natural logarithm over an array with configurable
+ * precision
+ *
+ * @param prec   Precise object managing FP environment
+ * @param in     Input array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be in itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Log(Prec &prec, const T *in, size_t count, T *out) {
+  logarithm::LogarithmArray<logarithm::Operation::kLog>(prec, in, count, out);
+}
+
+/// Compute log2(x) over an array, see the array overload of Log.
+template <typename Prec, typename T>
+NPSR_INTRIN void Log2(Prec &prec, const T *in, size_t count, T *out) {
+  logarithm::LogarithmArray<logarithm::Operation::kLog2>(prec, in, count, out);
+}
+
+/// Compute log10(x) over an array, see the array overload of Log.
+template <typename Prec, typename T>
+NPSR_INTRIN void Log10(Prec &prec, const T *in, size_t count, T *out) {
+  logarithm::LogarithmArray<logarithm::Operation::kLog10>(prec, in, count,
+                                                          out);
+}
+
+/// Compute log(1 + x) over an array, see the array overload of Log.
+template <typename Prec, typename T>
+NPSR_INTRIN void Log1p(Prec &prec, const T *in, size_t count, T *out) {
+  logarithm::LogarithmArray<logarithm::Operation::kLog1p>(prec, in, count,
+                                                          out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_LOGARITHM_INL_H_
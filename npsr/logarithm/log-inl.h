@@ -0,0 +1,277 @@
+#if defined(NPSR_LOGARITHM_LOG_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_LOGARITHM_LOG_INL_H_
+#undef NPSR_LOGARITHM_LOG_INL_H_
+#else
+#define NPSR_LOGARITHM_LOG_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoSum
+#include "npsr/hwy.h"
+#include "npsr/logarithm/data/data.h"
+#include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::logarithm {
+
+// Operation type of the logarithm kernels
+enum class Operation { kLog = 0, kLog2 = 1, kLog10 = 2, kLog1p = 3 };
+
+// log2 of the size of the 1/c table, see npsr/logarithm/data/logc-inl.h.sol
+constexpr int kTableBits = 5;
+
+// Exponent bias of T, 127 for float and 1023 for double
+template <typename T>
+constexpr int kExpBias = (1 << (hwy::ExponentBits<T>() - 1)) - 1;
+
+// Bits of kLogOffset = 0x1.628p-1, the lower end of the reduced z. Chosen so
+// 1 lies inside its table interval, with as much room below as above.
+template <typename T>
+constexpr hwy::MakeSigned<T> kLogOffsetBits =
+    static_cast<hwy::MakeSigned<T>>(std::is_same_v<T, float>
+                                        ? 0x3f314000LL
+                                        : 0x3fe6280000000000LL);
+
+/**
+ * This function splits a positive normal x into 2^k·z with
+ * z ∈ [kLogOffset, 2·kLogOffset). Returns z, k and the offset bits of x,
+ * whose top mantissa bits index the table.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V Decompose(V x, VI &k, VI &offset) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+
+  VI ix = BitCast(di, x);
+  offset = Sub(ix, Set(di, kLogOffsetBits<T>));
+  k = ShiftRight<kMantBits>(offset);
+  return BitCast(d, Sub(ix, ShiftLeft<kMantBits>(k)));
+}
+
+/**
+ * This function computes log(x), log2(x) or log10(x) of a positive normal x
+ * given as x + x_lo, where x_lo only matters for log1p and is otherwise
+ * zero. k_adj is added to the exponent of x, for inputs prescaled by the
+ * caller.
+ *
+ * Algorithm Overview:
+ * 1. Reduction: x = 2^k·z, see Decompose<>, then z = c·(1 + r) with 1/c
+ *    loaded through Lut. 1/c holds at most 7 significant bits, so
+ *    r = z·(1/c) - 1 is exact, by FMA or by splitting z when the target
+ *    has no native FMA
+ *
+ * 2. Polynomial Approximation: log(1 + r) ≈ r + r²·P(r), |r| < 2^-5.5, a
+ *    minimax polynomial generated by npsr/logarithm/data/log.h.sol. For
+ *    log1p, x_lo/x joins as r_lo·(1 - r)
+ *
+ * 3. Reconstruction: k·log_b(2) + (log(c) + log(1 + r))/ln(b), summed from
+ *    the largest term down with exact two-sums and log(c) as high and low
+ *    parts, so the result rounds once, ~0.55 ULP error. The conversion to
+ *    log2 and log10 is a double-word product, split by FMA or by halving
+ *    the digits of both operands.
+ *
+ * Without kTable, log(z) = f - (f²/2 - s·(f²/2 + R)) with f = z - 1,
+ * s = f/(2 + f) and R ≈ s²·Q(s²), the fdlibm formulation, no lookup at the
+ * cost of a division. ~0.85 ULP error, ~2.3 ULP for log2 and log10 which
+ * round the conversion.
+ */
+template <Operation OP, bool kTable, typename V, typename VI>
+NPSR_INTRIN V LogKernel(V x, V x_lo, VI k_adj) {
+  using namespace hn;
+  namespace data = ::npsr::logarithm::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+  const V one = Set(d, static_cast<T>(1.0));
+
+  VI k, offset;
+  V z = Decompose(x, k, offset);
+  V kf = ConvertTo(d, Add(k, k_adj));
+
+  // log_b(2) as an exact head for k and its tail, and 1/ln(b)
+  constexpr T kC0 = OP == Operation::kLog2    ? T(1)
+                    : OP == Operation::kLog10 ? data::kLog10Of2<T>[0]
+                                              : data::kLn2<T>[0];
+  constexpr T kC1 = OP == Operation::kLog2    ? T(0)
+                    : OP == Operation::kLog10 ? data::kLog10Of2<T>[1]
+                                              : data::kLn2<T>[1];
+  constexpr bool kScaled =
+      OP == Operation::kLog2 || OP == Operation::kLog10;
+  constexpr auto kB =
+      OP == Operation::kLog2 ? data::kInvLn2<T> : data::kInvLn10<T>;
+  constexpr auto kBSplit =
+      OP == Operation::kLog2 ? data::kInvLn2Split<T> : data::kInvLn10Split<T>;
+
+  if constexpr (kTable) {
+    V inv_c, logc_hi, logc_lo;
+    VI idx = And(ShiftRight<kMantBits - kTableBits>(offset),
+                 Set(di, (1 << kTableBits) - 1));
+    if constexpr (kIsSingle) {
+      kLogTableF32.Load(BitCast(du, idx), inv_c, logc_hi, logc_lo);
+    } else {
+      kLogTableF64.Load(BitCast(du, idx), inv_c, logc_hi, logc_lo);
+    }
+
+    V r;
+    if constexpr (kNativeFMA) {
+      r = MulSub(z, inv_c, one);
+    } else {
+      // z_hi keeps digits - 7 bits, both products and the sum are exact
+      const V z_hi = And(z, BitCast(d, Set(di, -(1 << 7))));
+      r = MulAdd(Sub(z, z_hi), inv_c, MulSub(z_hi, inv_c, one));
+    }
+    V tail;
+    if constexpr (OP == Operation::kLog1p) {
+      // x_lo/x = x_lo·2^-k·(1/c)/(1 + r), past 2^-(bias - 1) x_lo is far
+      // below the rounding of the result
+      VI neg_k = Max(Neg(k), Set(di, 1 - kExpBias<T>));
+      V scale = BitCast(
+          d, ShiftLeft<kMantBits>(Add(neg_k, Set(di, kExpBias<T>))));
+      V r_lo = Mul(Mul(x_lo, scale), inv_c);
+      // Two-sum into r, exact around x = 0 where c = 1 and r + r_lo = x
+      r = TwoSum(r, r_lo, r_lo);
+      r_lo = NegMulAdd(r_lo, r, r_lo);
+      tail = MulAdd(Mul(r, r), Poly(r, data::kLogPoly<T>), r_lo);
+    } else {
+      (void)x_lo;
+      tail = Mul(Mul(r, r), Poly(r, data::kLogPoly<T>));
+    }
+
+    // |log(c)| exceeds |r| unless c = 1, so the fast two-sum is exact
+    V l_hi = Add(logc_hi, r);
+    V l_lo = Add(Sub(logc_hi, l_hi), r);
+    l_lo = Add(l_lo, Add(logc_lo, tail));
+    if constexpr (kScaled && kNativeFMA) {
+      V p_hi = Mul(l_hi, Set(d, kB[0]));
+      V p_err = MulSub(l_hi, Set(d, kB[0]), p_hi);
+      l_lo = MulAdd(l_hi, Set(d, kB[1]), MulAdd(l_lo, Set(d, kB[0]), p_err));
+      l_hi = p_hi;
+    } else if constexpr (kScaled) {
+      // Half of the digits of l_hi times the split head of 1/ln(b) is exact
+      constexpr int kHalf = (hwy::MantissaBits<T>() + 2) / 2;
+      using TI = hwy::MakeSigned<T>;
+      V l_head = And(l_hi, BitCast(d, Set(di, -(TI{1} << kHalf))));
+      l_lo = Add(l_lo, Sub(l_hi, l_head));
+      l_hi = Mul(l_head, Set(d, kBSplit[0]));
+      l_lo = MulAdd(l_head, Set(d, kBSplit[1]), Mul(l_lo, Set(d, kB[0])));
+    }
+    // k·C₀ is exact and outweighs log_b(z) unless k = 0
+    V kc_hi = Mul(kf, Set(d, kC0));
+    V hi = Add(kc_hi, l_hi);
+    V lo = Add(Sub(kc_hi, hi), l_hi);
+    if constexpr (OP != Operation::kLog2) {
+      l_lo = MulAdd(kf, Set(d, kC1), l_lo);
+    }
+    return Add(hi, Add(lo, l_lo));
+  } else {
+    V f = Sub(z, one);
+    V s = Div(f, Add(f, Set(d, static_cast<T>(2.0))));
+    V w = Mul(s, s);
+    V r = Mul(w, Poly(w, data::kLogLowPoly<T>));
+    V hfsq = Mul(Set(d, static_cast<T>(0.5)), Mul(f, f));
+    // log(z) = f - (hfsq - s·(hfsq + R))
+    V lz_lo = MulSub(s, Add(hfsq, r), hfsq);
+    if constexpr (OP == Operation::kLog1p) {
+      lz_lo = Add(lz_lo, Div(x_lo, x));
+    } else {
+      (void)x_lo;
+    }
+    if constexpr (kScaled) {
+      V lz = Add(f, lz_lo);
+      return Add(Mul(kf, Set(d, kC0)),
+                 MulAdd(lz, Set(d, kB[0]), Mul(kf, Set(d, kC1))));
+    } else {
+      V kc_lo = Mul(kf, Set(d, kC1));
+      return Add(Mul(kf, Set(d, kC0)), Add(f, Add(lz_lo, kc_lo)));
+    }
+  }
+}
+
+/**
+ * This function computes log(x) of a positive normal x as a double-word
+ * hi + lo, ~2^-40 (float) and ~2^-67 (double) relative error, for
+ * callers that multiply the result by a large factor such as pow. k_adj is
+ * added to the exponent of x, for inputs prescaled by the caller.
+ *
+ * Same reduction and table as LogKernel<>, but log(1 + r) is summed as
+ * r - r²/2 + r³·S(r), with r²/2 split exactly by FMA or by halving the
+ * digits of r, so only r³·S(r) rounds, far below the low part. Every sum
+ * of the reconstruction is an exact two-sum.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V LogKernelDW(V x, VI k_adj, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::logarithm::data;
+  using T = TFromV<V>;
+  using TI = hwy::MakeSigned<T>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+  const V one = Set(d, static_cast<T>(1.0));
+  const V half = Set(d, static_cast<T>(0.5));
+
+  VI k, offset;
+  V z = Decompose(x, k, offset);
+  V kf = ConvertTo(d, Add(k, k_adj));
+
+  V inv_c, logc_hi, logc_lo;
+  VI idx = And(ShiftRight<kMantBits - kTableBits>(offset),
+               Set(di, (1 << kTableBits) - 1));
+  if constexpr (kIsSingle) {
+    kLogTableF32.Load(BitCast(du, idx), inv_c, logc_hi, logc_lo);
+  } else {
+    kLogTableF64.Load(BitCast(du, idx), inv_c, logc_hi, logc_lo);
+  }
+
+  V r, r2_hi, r2_lo;
+  if constexpr (kNativeFMA) {
+    r = MulSub(z, inv_c, one);
+    r2_hi = Mul(r, r);
+    r2_lo = MulSub(r, r, r2_hi);
+  } else {
+    const V z_hi = And(z, BitCast(d, Set(di, -(1 << 7))));
+    r = MulAdd(Sub(z, z_hi), inv_c, MulSub(z_hi, inv_c, one));
+    // r_head² is exact, r² - r_head² = (r - r_head)·(r + r_head) only
+    // rounds far below r²
+    constexpr int kHalf = (kMantBits + 2) / 2;
+    V r_head = And(r, BitCast(d, Set(di, -(TI{1} << kHalf))));
+    r2_hi = Mul(r_head, r_head);
+    r2_lo = Mul(Sub(r, r_head), Add(r, r_head));
+  }
+  V tail = Mul(Mul(Mul(r, r), r), Poly(r, data::kLogPowPoly<T>));
+
+  // |log(c)| exceeds |r| unless c = 1, and |log(c) + r| exceeds r²/2
+  V l_hi = Add(logc_hi, r);
+  V l_lo = Add(Sub(logc_hi, l_hi), r);
+  V h = NegMulAdd(half, r2_hi, l_hi);
+  l_lo = Add(l_lo, NegMulAdd(half, r2_hi, Sub(l_hi, h)));
+  l_hi = h;
+  l_lo = Add(l_lo, Add(logc_lo, NegMulAdd(half, r2_lo, tail)));
+
+  // k·ln2 as an exact head and a tail that rounds past 2·digits. The tail
+  // is too large to be left in lo, which is renormalized to below the ULP
+  // of hi
+  V kc_hi = Mul(kf, Set(d, data::kLn2<T>[0]));
+  V hi = Add(kc_hi, l_hi);
+  lo = Add(Sub(kc_hi, hi), l_hi);
+  lo = Add(lo, MulAdd(kf, Set(d, data::kLn2<T>[1]), l_lo));
+  V sum = Add(hi, lo);
+  lo = Sub(lo, Sub(sum, hi));
+  return sum;
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::logarithm
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_LOGARITHM_LOG_INL_H_
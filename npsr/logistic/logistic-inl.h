@@ -0,0 +1,173 @@
+#if defined(NPSR_LOGISTIC_LOGISTIC_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_LOGISTIC_LOGISTIC_INL_H_
+#undef NPSR_LOGISTIC_LOGISTIC_INL_H_
+#else
+#define NPSR_LOGISTIC_LOGISTIC_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoProd
+#include "npsr/exponential/exp-inl.h"
+#include "npsr/hwy.h"
+#include "npsr/logaddexp/logaddexp-inl.h"  // ExpNonPositive
+#include "npsr/logarithm/log-inl.h"        // LogKernel
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::logistic {
+
+// Operation type of the logistic kernels
+enum class Operation { kExpit = 0, kLogit = 1 };
+
+/**
+ * Smallest x whose expit rounds to 1, e^-x below half an ULP of 1:
+ * 25·ln2 (float) and 54·ln2 (double), rounded up.
+ */
+template <typename T>
+inline constexpr T kExpitSaturation = std::is_same_v<T, float> ? 17.5f : 37.5;
+
+/**
+ * 1/s for s ∈ [1, 2] from the reciprocal estimate, refined by Newton's
+ * iteration r + r·(1 - s·r), which squares the error each step. The estimate
+ * holds 8 bits on some targets, so float takes two steps and double three,
+ * ~0.5 ULP error.
+ */
+template <typename V>
+NPSR_INTRIN V ReciprocalNewton(V s) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const V one = Set(d, static_cast<T>(1.0));
+  constexpr int kSteps = std::is_same_v<T, float> ? 2 : 3;
+
+  V r = ApproximateReciprocal(s);
+  for (int i = 0; i < kSteps; ++i) {
+    r = MulAdd(r, NegMulAdd(s, r, one), r);
+  }
+  return r;
+}
+
+/**
+ * This function computes expit(x) = 1/(1 + e^-x) without branches on the
+ * sign of x.
+ *
+ * Algorithm Overview:
+ * 1. Exponential: e = e^-|x| ≤ 1, see logaddexp::ExpNonPositive<>, so it
+ *    never overflows and s = 1 + e ∈ [1, 2] by fast two-sum
+ *
+ * 2. Sign: expit(|x|) = 1/s and expit(-|x|) = e/s, the numerator picked by
+ *    a select, which keeps the relative accuracy of the tiny negative side
+ *    that 1 - 1/s would cancel
+ *
+ * 3. Quotient: with kHigh, e and s are double-words, 1/s one division and
+ *    the quotient corrected by its residual, exact through
+ *    TwoProd<>, so the result rounds once, ~0.5 ULP error. Float
+ *    widens to the double low tier instead. Otherwise e comes from the
+ *    polynomial over |r| ≤ ln2/2 and 1/s from the reciprocal estimate, see
+ *    ReciprocalNewton<>, with no division, ~3 ULP error.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V ExpitKernel(V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  if constexpr (kHigh && std::is_same_v<T, float>) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, ExpitKernel<false>(PromoteLowerTo(dw, x)));
+    auto up = DemoteTo(dh, ExpitKernel<false>(PromoteUpperTo(dw, x)));
+    return Combine(d, up, lo);
+  } else {
+    const auto is_neg = Lt(x, Zero(d));
+    V e_lo;
+    V e = logaddexp::ExpNonPositive<exponential::Operation::kExp, kHigh>(
+        Neg(Abs(x)), Zero(d), e_lo);
+    V s = Add(one, e);
+    V num = IfThenElse(is_neg, e, one);
+    if constexpr (kHigh) {
+      V s_lo = Add(Add(Sub(one, s), e), e_lo);
+      V num_lo = IfThenElseZero(is_neg, e_lo);
+      V inv = Div(one, s);
+      V q = Mul(num, inv);
+      V p_lo;
+      V p_hi = TwoProd(q, s, p_lo);
+      V resid = Sub(Sub(num, p_hi), p_lo);
+      resid = Add(resid, NegMulAdd(q, s_lo, num_lo));
+      return MulAdd(resid, inv, q);
+    } else {
+      return Mul(num, ReciprocalNewton(s));
+    }
+  }
+}
+
+/**
+ * This function computes logit(p) = log(p/(1 - p)) of p ∈ (0, 1).
+ *
+ * Algorithm Overview:
+ * 1. Ratio: 1 - p as a fast two-sum a + a_lo, exact for p ≥ 1/2, and
+ *    q = p/(1 - p) as a double-word: q_hi = p·(1/a), its residual
+ *    p - q_hi·a exact through TwoProd<>, q_lo = residual·(1/a)
+ *
+ * 2. Logarithm: log(q_hi + q_lo) by the log1p form of
+ *    logarithm::LogKernel<>, which keeps q_lo around q = 1, where
+ *    p ≈ 1/2 and the result cancels
+ *
+ * With kSub, q below the normal range, only reached by subnormal p where
+ * q = p, is scaled into it and its exponent compensated.
+ *
+ * With kHigh, 1/a is a division and the logarithm uses its table, ~0.55 ULP
+ * error. Float widens to the double low tier instead. Otherwise 1/a comes
+ * from ReciprocalNewton<> and the logarithm from fdlibm's form, ~0.9 ULP
+ * error.
+ */
+template <bool kHigh, bool kSub, typename V>
+NPSR_INTRIN V LogitKernel(V p) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  if constexpr (kHigh && std::is_same_v<T, float>) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, LogitKernel<false, false>(PromoteLowerTo(dw, p)));
+    auto up = DemoteTo(dh, LogitKernel<false, false>(PromoteUpperTo(dw, p)));
+    return Combine(d, up, lo);
+  } else {
+    V a = Sub(one, p);
+    V a_lo = Sub(Sub(one, a), p);
+    V inv;
+    if constexpr (kHigh) {
+      inv = Div(one, a);
+    } else {
+      inv = ReciprocalNewton(a);
+    }
+    V q_hi = Mul(p, inv);
+    V p_lo;
+    V p_hi = TwoProd(q_hi, a, p_lo);
+    V resid = NegMulAdd(q_hi, a_lo, Sub(Sub(p, p_hi), p_lo));
+    V q_lo = Mul(resid, inv);
+
+    VI k_adj = Zero(di);
+    if constexpr (kSub) {
+      constexpr int kShift = hwy::MantissaBits<T>() + 1;
+      const auto is_sub = Lt(q_hi, Set(d, std::numeric_limits<T>::min()));
+      const V scale = exponential::Pow2I(d, Set(di, kShift));
+      q_hi = IfThenElse(is_sub, Mul(q_hi, scale), q_hi);
+      q_lo = IfThenZeroElse(is_sub, q_lo);
+      k_adj = IfThenElseZero(RebindMask(di, is_sub), Set(di, -kShift));
+    }
+    return logarithm::LogKernel<logarithm::Operation::kLog1p, kHigh>(
+        q_hi, q_lo, k_adj);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::logistic
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_LOGISTIC_LOGISTIC_INL_H_
@@ -6,6 +6,16 @@
 #define NPSR_NPSR_H_
 #endif
 
+#include "npsr/erf/inl.h"
+#include "npsr/exponential/inl.h"
+#include "npsr/gamma/inl.h"
+#include "npsr/hyperbolic/inl.h"
+#include "npsr/invhyperbolic/inl.h"
+#include "npsr/invtrig/inl.h"
+#include "npsr/logaddexp/inl.h"
+#include "npsr/logarithm/inl.h"
+#include "npsr/logistic/inl.h"
+#include "npsr/power/inl.h"
 #include "npsr/trig/inl.h"
 
 #endif  // NPSR_NPSR_H_
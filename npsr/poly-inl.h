@@ -0,0 +1,271 @@
+#if defined(NPSR_POLY_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POLY_INL_H_
+#undef NPSR_POLY_INL_H_
+#else
+#define NPSR_POLY_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Polynomial evaluation schemes.
+ *
+ * - kHorner: one dependent FMA per coefficient. Fewest operations and the
+ *   tightest rounding, but the whole chain is latency bound.
+ * - kEstrin: pairs coefficients into independent FMAs and combines them
+ *   with x², x⁴, ...; the dependency depth drops to ~log2(N) FMAs at the
+ *   cost of the extra squarings. The constant term is still added by a
+ *   single final FMA, so the dominant term is rounded as in Horner.
+ * - kSplit: even/odd split P(x) = E(x²) + x·O(x²), two independent Horner
+ *   chains of half the length. A middle ground for short polynomials.
+ */
+enum class PolyScheme { kHorner, kEstrin, kSplit };
+
+// Per-target default. Estrin only pays off when MulAdd is fused, every
+// FMA-capable core issues at least two of them per cycle. Without native
+// FMA each MulAdd is already two dependent instructions and the extra
+// squarings only add work.
+constexpr PolyScheme kPolyDefault =
+    kNativeFMA ? PolyScheme::kEstrin : PolyScheme::kHorner;
+
+// Largest power of two strictly below `n`
+constexpr size_t PolyHalf_(size_t n) {
+  size_t half = 1;
+  while (half * 2 < n) {
+    half *= 2;
+  }
+  return half;
+}
+
+template <typename V, typename T, size_t N>
+NPSR_INTRIN V PolyHorner_(V x, const T (&coeffs)[N]) {
+  using namespace hn;
+  const DFromV<V> d;
+  V poly = Set(d, coeffs[0]);
+  for (size_t i = 1; i < N; ++i) {
+    poly = MulAdd(poly, x, Set(d, coeffs[i]));
+  }
+  return poly;
+}
+
+// Evaluates the ascending-degree slice [kLo, kLo + kLen) of `coeffs`,
+// degree k being stored at coeffs[N - 1 - k]
+template <size_t kLo, size_t kLen, typename V, typename T, size_t N>
+NPSR_INTRIN V PolyEstrin_(const T (&coeffs)[N], V x, V x2, V x4, V x8,
+                          V x16) {
+  using namespace hn;
+  const DFromV<V> d;
+  if constexpr (kLen == 1) {
+    return Set(d, coeffs[N - 1 - kLo]);
+  } else {
+    constexpr size_t kHalf = PolyHalf_(kLen);
+    V lo = PolyEstrin_<kLo, kHalf>(coeffs, x, x2, x4, x8, x16);
+    V hi = PolyEstrin_<kLo + kHalf, kLen - kHalf>(coeffs, x, x2, x4, x8, x16);
+    V xh = kHalf == 1   ? x
+           : kHalf == 2 ? x2
+           : kHalf == 4 ? x4
+           : kHalf == 8 ? x8
+                        : x16;
+    return MulAdd(hi, xh, lo);
+  }
+}
+
+// Horner over every other ascending degree, starting from kTop down to kLow
+template <int kTop, int kLow, typename V, typename T, size_t N>
+NPSR_INTRIN V PolyStride2_(V x2, const T (&coeffs)[N]) {
+  using namespace hn;
+  const DFromV<V> d;
+  V poly = Set(d, coeffs[N - 1 - kTop]);
+  for (int k = kTop - 2; k >= kLow; k -= 2) {
+    poly = MulAdd(poly, x2, Set(d, coeffs[N - 1 - k]));
+  }
+  return poly;
+}
+
+/**
+ * @brief Evaluates a polynomial with constant coefficients.
+ *
+ * Coefficients are ordered from the highest degree down, the layout emitted
+ * by MinimaxCoeffs (tools/sollya/core.sol), so this computes
+ * coeffs[0]·x^(N-1) + ... + coeffs[N-2]·x + coeffs[N-1].
+ *
+ * @tparam kScheme  Evaluation scheme, kPolyDefault unless specified
+ * @param x         Polynomial variable
+ * @param coeffs    Coefficients, a data table or a braced list
+ * @return          P(x)
+ *
+ * @example
+ * ```cpp
+ * // sin(r)/r - 1 on a reduced range, in r²
+ * V poly = Poly(r2, {c9, c7, c5, c3});
+ * // force a scheme, e.g. when several vectors already hide the latency
+ * V poly = Poly<PolyScheme::kHorner>(r2, data::kSinLadder<T, 7>);
+ * ```
+ */
+template <PolyScheme kScheme = kPolyDefault, typename V, typename T, size_t N>
+NPSR_INTRIN V Poly(V x, const T (&coeffs)[N]) {
+  using namespace hn;
+  static_assert(N > 0 && N <= 32, "Supports polynomials of degree < 32");
+  if constexpr (kScheme == PolyScheme::kHorner || N <= 2) {
+    return PolyHorner_(x, coeffs);
+  } else if constexpr (kScheme == PolyScheme::kEstrin) {
+    // Powers beyond the polynomial's degree are never read
+    const V x2 = Mul(x, x);
+    const V x4 = N > 5 ? Mul(x2, x2) : x2;
+    const V x8 = N > 9 ? Mul(x4, x4) : x4;
+    const V x16 = N > 17 ? Mul(x8, x8) : x8;
+    // Estrin over the degrees >= 1, then one FMA onto the constant term so
+    // it is rounded once like in Horner; it usually dominates the result
+    const V tail = PolyEstrin_<1, N - 1>(coeffs, x, x2, x4, x8, x16);
+    return MulAdd(tail, x, Set(DFromV<V>(), coeffs[N - 1]));
+  } else {
+    static_assert(kScheme == PolyScheme::kSplit);
+    constexpr int kTop = static_cast<int>(N) - 1;
+    const V x2 = Mul(x, x);
+    V even = PolyStride2_<kTop - kTop % 2, 0>(x2, coeffs);
+    V odd = PolyStride2_<kTop - 1 + kTop % 2, 1>(x2, coeffs);
+    return MulAdd(odd, x, even);
+  }
+}
+
+/**
+ * @brief Evaluates polynomials at several independent variables, their
+ * steps issued in lockstep.
+ *
+ * Each step of Poly<>, one FMA of a Horner chain or one node of the Estrin
+ * tree, is emitted for every variable before the next step of any, so K
+ * variables keep K independent operations in flight by construction rather
+ * than by the scheduler's good will. The operations of each variable are
+ * those of Poly<> with the same scheme, so the results are bit-identical.
+ *
+ * The vector types are template arguments of the struct so that each
+ * variable is passed as its own named parameter, sizeless vectors of SVE
+ * and RVV cannot be array elements. Per-variable temporaries are passed the
+ * same way, as by-value parameter packs of the helpers below.
+ *
+ * @example
+ * ```cpp
+ * V p0, p1;
+ * PolyLockstep<V, V>::Eval(kCoeffs, r2_0, r2_1, p0, p1);
+ * // two polynomials per variable set, e.g. sine and cosine of r²
+ * PolyLockstep<V, V>::Eval(kSin, r2_0, r2_1, s0, s1, kCos, r2_0, r2_1, c0,
+ *                          c1);
+ * ```
+ */
+template <typename... V>
+struct PolyLockstep {
+  template <PolyScheme kScheme = kPolyDefault, typename T, size_t N>
+  NPSR_INTRIN void Eval(const T (&coeffs)[N], const V... x, V &...p) {
+    using namespace hn;
+    static_assert(N > 0 && N <= 32, "Supports polynomials of degree < 32");
+    static_assert(kScheme != PolyScheme::kSplit,
+                  "kSplit has no lockstep form, use kHorner or kEstrin");
+    if constexpr (kScheme == PolyScheme::kHorner || N <= 2) {
+      ((p = Set(DFromV<V>(), coeffs[0])), ...);
+      for (size_t i = 1; i < N; ++i) {
+        ((p = MulAdd(p, x, Set(DFromV<V>(), coeffs[i]))), ...);
+      }
+    } else {
+      EstrinPowers_(coeffs, x..., Mul(x, x)..., p...);
+    }
+  }
+
+  /// Two polynomials per variable set; with kHorner their steps interleave
+  /// too, the shorter one joining late.
+  template <PolyScheme kScheme = kPolyDefault, typename T, size_t N, size_t M>
+  NPSR_INTRIN void Eval(const T (&coeffs0)[N], const V... x, V &...p,
+                        const T (&coeffs1)[M], const V... y, V &...q) {
+    using namespace hn;
+    if constexpr (kScheme == PolyScheme::kHorner) {
+      constexpr size_t kSteps = N > M ? N : M;
+      for (size_t i = 0; i < kSteps; ++i) {
+        if (i + N >= kSteps) {
+          const size_t k = i + N - kSteps;
+          if (k == 0) {
+            ((p = Set(DFromV<V>(), coeffs0[0])), ...);
+          } else {
+            ((p = MulAdd(p, x, Set(DFromV<V>(), coeffs0[k]))), ...);
+          }
+        }
+        if (i + M >= kSteps) {
+          const size_t k = i + M - kSteps;
+          if (k == 0) {
+            ((q = Set(DFromV<V>(), coeffs1[0])), ...);
+          } else {
+            ((q = MulAdd(q, y, Set(DFromV<V>(), coeffs1[k]))), ...);
+          }
+        }
+      }
+    } else {
+      Eval<kScheme>(coeffs0, x..., p...);
+      Eval<kScheme>(coeffs1, y..., q...);
+    }
+  }
+
+  // Powers of Poly<>'s Estrin branch, beyond the degree never read
+  template <typename T, size_t N>
+  NPSR_INTRIN void EstrinPowers_(const T (&coeffs)[N], const V... x,
+                                 const V... x2, V &...p) {
+    using namespace hn;
+    EstrinPowers_(coeffs, x..., x2..., (N > 5 ? Mul(x2, x2) : x2)..., p...);
+  }
+  template <typename T, size_t N>
+  NPSR_INTRIN void EstrinPowers_(const T (&coeffs)[N], const V... x,
+                                 const V... x2, const V... x4, V &...p) {
+    using namespace hn;
+    EstrinPowers_(coeffs, x..., x2..., x4..., (N > 9 ? Mul(x4, x4) : x4)...,
+                  p...);
+  }
+  template <typename T, size_t N>
+  NPSR_INTRIN void EstrinPowers_(const T (&coeffs)[N], const V... x,
+                                 const V... x2, const V... x4, const V... x8,
+                                 V &...p) {
+    using namespace hn;
+    // Estrin over the degrees >= 1, then one FMA onto the constant term
+    EstrinNode_<1, N - 1>(coeffs, x..., x2..., x4..., x8...,
+                          (N > 17 ? Mul(x8, x8) : x8)..., p...);
+    ((p = MulAdd(p, x, Set(DFromV<V>(), coeffs[N - 1]))), ...);
+  }
+
+  // PolyEstrin_<kLo, kLen> of every variable, node by node
+  template <size_t kLo, size_t kLen, typename T, size_t N>
+  NPSR_INTRIN void EstrinNode_(const T (&coeffs)[N], const V... x,
+                               const V... x2, const V... x4, const V... x8,
+                               const V... x16, V &...p) {
+    using namespace hn;
+    if constexpr (kLen == 1) {
+      ((p = Set(DFromV<V>(), coeffs[N - 1 - kLo])), ...);
+    } else {
+      constexpr size_t kHalf = PolyHalf_(kLen);
+      EstrinNode_<kLo, kHalf>(coeffs, x..., x2..., x4..., x8..., x16..., p...);
+      // The by-value copies of p are the scratch of the upper half
+      EstrinUpper_<kLo + kHalf, kLen - kHalf, kHalf>(
+          coeffs, x..., x2..., x4..., x8..., x16..., p..., p...);
+    }
+  }
+  template <size_t kLo, size_t kLen, size_t kHalf, typename T, size_t N>
+  NPSR_INTRIN void EstrinUpper_(const T (&coeffs)[N], const V... x,
+                                const V... x2, const V... x4, const V... x8,
+                                const V... x16, V &...p, V... hi) {
+    using namespace hn;
+    EstrinNode_<kLo, kLen>(coeffs, x..., x2..., x4..., x8..., x16..., hi...);
+    ((p = MulAdd(hi,
+                 kHalf == 1   ? x
+                 : kHalf == 2 ? x2
+                 : kHalf == 4 ? x4
+                 : kHalf == 8 ? x8
+                              : x16,
+                 p)),
+     ...);
+  }
+};
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_POLY_INL_H_
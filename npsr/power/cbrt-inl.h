@@ -0,0 +1,150 @@
+#if defined(NPSR_POWER_CBRT_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POWER_CBRT_INL_H_
+#undef NPSR_POWER_CBRT_INL_H_
+#else
+#define NPSR_POWER_CBRT_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"               // TwoProd
+#include "npsr/exponential/exp-inl.h"  // Pow2I, kExpBias
+#include "npsr/hwy.h"
+#include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
+#include "npsr/power/data/data.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::power {
+
+/**
+ * Bias of the exponent quotient, keeps e + 3·kCbrtQBias positive for every
+ * exponent e of a normal input and below 2^15, where the division by 3 is
+ * exact as a product by 0x5556 shifted right by 16.
+ */
+template <typename T>
+inline constexpr int kCbrtQBias = std::is_same_v<T, float> ? 60 : 400;
+
+/**
+ * This function splits a positive normal x into 2^(3q + k)·m with
+ * m ∈ [1, 2) and k ∈ {0, 1, 2}, all by integer arithmetic on the bits of x.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN V CbrtDecompose(V x, VI &q, VI &k) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using TI = hwy::MakeSigned<T>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr int kMantBits = hwy::MantissaBits<T>();
+  constexpr int kBias = exponential::kExpBias<T>;
+
+  VI ix = BitCast(di, x);
+  VI n = Add(ShiftRight<kMantBits>(ix), Set(di, 3 * kCbrtQBias<T> - kBias));
+  VI n3 = ShiftRight<16>(Mul(n, Set(di, 0x5556)));
+  k = Sub(n, Add(n3, Add(n3, n3)));
+  q = Sub(n3, Set(di, kCbrtQBias<T>));
+  const VI mant_mask = Set(di, (TI{1} << kMantBits) - 1);
+  const VI one_bits = Set(di, static_cast<TI>(kBias) << kMantBits);
+  return BitCast(d, Or(And(ix, mant_mask), one_bits));
+}
+
+/// One Newton step toward cbrt(m): y - (y³ - m)/(3y²)
+template <typename V>
+NPSR_INTRIN V CbrtNewton(V y, V m) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  V y2 = Mul(y, y);
+  V resid = MulSub(y2, y, m);
+  return Sub(y, Div(resid, Mul(y2, Set(d, static_cast<T>(3.0)))));
+}
+
+/**
+ * This function computes the cube root of a positive normal x.
+ *
+ * Algorithm Overview:
+ * 1. Reduction: x = 2^(3q + k)·m, see CbrtDecompose<>, so
+ *    cbrt(x) = 2^q · 2^(k/3) · cbrt(m)
+ *
+ * 2. Seed: cbrt(m) ≈ P(m), m ∈ [1, 2), a minimax polynomial generated by
+ *    npsr/power/data/cbrt.h.sol, relative error 2^-13.6 (float) and
+ *    2^-19.4 (double)
+ *
+ * 3. Refinement: Newton's iteration squares the error each step
+ *    - Low tier: one step for float, two for double, ~1.5 ULP error
+ *    - High tier: one step, then the residual m - y³ is taken exactly by
+ *      TwoProd<>, so y + (m - y³)/(3y²) is a double-word accurate
+ *      to ~2^-76. Float widens to the double low tier instead, whose
+ *      ~2^-52 error rounds away, ~0.5 ULP error.
+ *
+ * 4. Reconstruction: 2^(k/3) is loaded as high and low parts through Lut,
+ *    see npsr/power/data/cbrt2k-inl.h, and 2^q is exact. The high tier
+ *    multiplies the double-words so the result rounds once, ~0.5 ULP error,
+ *    and perfect cubes come out exact.
+ */
+template <bool kHigh, typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V CbrtKernel(V x) {
+  using namespace hn;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  namespace data = ::npsr::power::data;
+  const DFromV<V> d;
+  const RebindToUnsigned<decltype(d)> du;
+
+  VI q, k;
+  V m = CbrtDecompose(x, q, k);
+  V y = CbrtNewton(Poly(m, data::kCbrtPoly<double>), m);
+  V c_hi, c_lo;
+  kCbrt2kTableF64.Load(BitCast(du, k), c_hi, c_lo);
+
+  V ret;
+  if constexpr (kHigh) {
+    // m - y³ with y³ as a double-word, m - u_hi is exact by Sterbenz's lemma
+    V t_lo;
+    V t_hi = TwoProd(y, y, t_lo);
+    V u_lo;
+    V u_hi = TwoProd(t_hi, y, u_lo);
+    u_lo = MulAdd(t_lo, y, u_lo);
+    V resid = Sub(Sub(m, u_hi), u_lo);
+    V y_lo = Div(resid, Mul(t_hi, Set(d, 3.0)));
+    V p_lo;
+    V p_hi = TwoProd(y, c_hi, p_lo);
+    ret = Add(p_hi, MulAdd(y, c_lo, MulAdd(y_lo, c_hi, p_lo)));
+  } else {
+    y = CbrtNewton(y, m);
+    ret = MulAdd(y, c_hi, Mul(y, c_lo));
+  }
+  return Mul(ret, exponential::Pow2I(d, q));
+}
+
+/// Float, see the double kernel above.
+template <bool kHigh, typename V, HWY_IF_F32(TFromV<V>)>
+NPSR_INTRIN V CbrtKernel(V x) {
+  using namespace hn;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  namespace data = ::npsr::power::data;
+  const DFromV<V> d;
+
+  if constexpr (kHigh) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, CbrtKernel<false>(PromoteLowerTo(dw, x)));
+    auto up = DemoteTo(dh, CbrtKernel<false>(PromoteUpperTo(dw, x)));
+    return Combine(d, up, lo);
+  } else {
+    const RebindToUnsigned<decltype(d)> du;
+    VI q, k;
+    V m = CbrtDecompose(x, q, k);
+    V y = CbrtNewton(Poly(m, data::kCbrtPoly<float>), m);
+    V c_hi, c_lo;
+    kCbrt2kTableF32.Load(BitCast(du, k), c_hi, c_lo);
+    V ret = MulAdd(y, c_hi, Mul(y, c_lo));
+    return Mul(ret, exponential::Pow2I(d, q));
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::power
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_POWER_CBRT_INL_H_
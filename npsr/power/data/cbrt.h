@@ -0,0 +1,20 @@
+// Auto-generated by npsr/power/data/cbrt.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_POWER_DATA_CBRT_H
+#define NPSR_POWER_DATA_CBRT_H
+
+namespace npsr::power::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kCbrtPoly[] = {};
+// cbrt degree 3, m ∈ [1, 2], relative error 2^-13.59375
+template <> inline constexpr float kCbrtPoly<float>[] = {
+0x1.7691aap-6f, -0x1.4b8decp-3f, 0x1.2bce5p-1f, 0x1.1b6b3ap-1f, 
+};
+// cbrt degree 5, m ∈ [1, 2], relative error 2^-19.4375
+template <> inline constexpr double kCbrtPoly<double>[] = {
+0x1.58f4e05d95a92p-8, -0x1.97a3ed204d47fp-5, 0x1.9b8f1a4ec4933p-3, -0x1.ddd0473de91c2p-2, 
+0x1.ac30adcee642dp-1, 0x1.e5386701279adp-2, };
+
+} // namespace npsr::power::data
+
+#endif // NPSR_POWER_DATA_CBRT_H
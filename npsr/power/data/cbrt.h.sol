@@ -0,0 +1,44 @@
+// Generates the minimax polynomial of the cube root kernel
+// (see npsr/power/cbrt-inl.h).
+//
+// The input is split as x = 2^(3q + k)·m with m ∈ [1, 2) and k ∈ {0, 1, 2},
+// so cbrt(x) = 2^q · 2^(k/3) · cbrt(m), 2^(k/3) coming from
+// npsr/power/data/cbrt2k-inl.h. The polynomial only seeds cbrt(m):
+//   cbrt(m) ≈ P(m),  m ∈ [1, 2]
+// and Newton's iteration carries it the rest of the way, so a low degree is
+// enough, the error squaring with each step.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Degree of the polynomial
+procedure Cbrt_(pT, pDeg) {
+  var i, $;
+  $.range = [1; 2];
+  $.monos = [||];
+  for i from 0 to pDeg do {
+    $.monos = $.monos :. i;
+  };
+  $.p = MinimaxCoeffs(pT, x^(1/3), $.monos, $.range, 0);
+  $.array = CArrayT(pT, $.p.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// cbrt degree " @ pDeg @ ", m ∈ [1, 2]" @
+    ", relative error 2^" @ round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kCbrtPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kCbrtPoly[] = {};"
+);
+Append @ Cbrt_(Float32, 3);
+Append @ Cbrt_(Float64, 5);
+Append("");
+
+WriteCPPHeader("npsr::power::data");
@@ -0,0 +1,35 @@
+// Auto-generated by npsr/power/data/cbrt2k-inl.h.sol
+// Use `spin sollya -f` to force regeneration
+#if defined(NPSR_POWER_DATA_CBRT2K_INL_H) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POWER_DATA_CBRT2K_INL_H
+#undef NPSR_POWER_DATA_CBRT2K_INL_H
+#else
+#define NPSR_POWER_DATA_CBRT2K_INL_H
+#endif
+
+HWY_BEFORE_NAMESPACE();
+namespace npsr::HWY_NAMESPACE::power {
+inline constexpr auto kCbrt2kTableF32 = MakeLut<float>(
+// High parts of 2^(k/3)
+{
+0x1p0f, 0x1.428a3p0f, 0x1.965feap0f, 0x1p1f, 
+},
+// Low parts of 2^(k/3)
+{
+0.0f, -0x1.9ca35ep-26f, 0x1.4f5b9p-26f, 0.0f, 
+}
+);
+inline constexpr auto kCbrt2kTableF64 = MakeLut<double>(
+// High parts of 2^(k/3)
+{
+0x1p0, 0x1.428a2f98d728bp0, 0x1.965fea53d6e3dp0, 0x1p1, 
+},
+// Low parts of 2^(k/3)
+{
+0.0, -0x1.ddc22548ea41ep-56, -0x1.f53e999952f09p-54, 0.0, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_POWER_DATA_CBRT2K_INL_H(){}
+} // namespace npsr::HWY_NAMESPACE::power
+HWY_AFTER_NAMESPACE();
+#endif // NPSR_POWER_DATA_CBRT2K_INL_H
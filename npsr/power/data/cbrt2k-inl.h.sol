@@ -0,0 +1,42 @@
+// Generates the lookup table of the cube root kernel
+// (see npsr/power/cbrt-inl.h).
+//
+// The kernel writes cbrt(x) = 2^q · 2^(k/3) · cbrt(m) with k = e - 3q the
+// remainder of the exponent e of x, and loads 2^(k/3) as a high part and the
+// rounding error of it. Only k ∈ {0, 1, 2} is ever loaded, the column k = 3
+// holds 2 so the row fills a whole vector of four lanes.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pLow - false for the high parts, true for the low parts
+procedure Cbrt2kTable_(pT, pLow) {
+  var r, k, $;
+  r = [||];
+  for k from 0 to 3 do {
+    $.exact = 2^(k / 3);
+    $.hi = pT.kRound($.exact);
+    if (pLow) then {
+      r = r :. pT.kRound($.exact - $.hi);
+    } else {
+      r = r :. $.hi;
+    };
+  };
+  return CArrayT(pT, r, 4);
+};
+
+Append(
+  "inline constexpr auto kCbrt2kTableF32 = MakeLut<float>(",
+  "// High parts of 2^(k/3)",
+  Cbrt2kTable_(Float32, false) @ ",",
+  "// Low parts of 2^(k/3)",
+  Cbrt2kTable_(Float32, true),
+  ");",
+  "inline constexpr auto kCbrt2kTableF64 = MakeLut<double>(",
+  "// High parts of 2^(k/3)",
+  Cbrt2kTable_(Float64, false) @ ",",
+  "// Low parts of 2^(k/3)",
+  Cbrt2kTable_(Float64, true),
+  ");"
+);
+
+WriteHighwayHeader("npsr::HWY_NAMESPACE::power");
@@ -0,0 +1,10 @@
+// Aggregates the power data headers. Hand-written: it only forwards
+// includes, so there is nothing for Sollya to generate.
+//
+// Intentionally NOT guarded with #ifndef: it pulls in the Highway
+// target-toggled header cbrt2k-inl.h, which must be re-included once per
+// SIMD target, see npsr/trig/data/data.h. The include-once child (cbrt)
+// carries its own guard and no-ops on re-entry.
+#include "npsr/lut-inl.h"
+#include "npsr/power/data/cbrt.h"
+#include "npsr/power/data/cbrt2k-inl.h"
@@ -0,0 +1,116 @@
+#if defined(NPSR_POWER_HYPOT_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POWER_HYPOT_INL_H_
+#undef NPSR_POWER_HYPOT_INL_H_
+#else
+#define NPSR_POWER_HYPOT_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/dw-inl.h"               // TwoProd
+#include "npsr/exponential/exp-inl.h"  // Pow2I, kExpBias
+#include "npsr/hwy.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::power {
+
+/**
+ * This function computes √(a² + b²) for a ≥ b ≥ 0 whose squares stay within
+ * the normal range.
+ *
+ * - Low tier: √(fma(a, a, b·b)), the sum rounds once and the square root
+ *   halves its error, ~1 ULP error.
+ * - High tier: the squares are double-words by TwoProd<>, summed
+ *   without losing their low parts, a² dominating. The rounded root r is
+ *   corrected by (s - r²)/(2r), where s - r² is exact, taken by FMA or by
+ *   TwoProd<> and Sterbenz's lemma, so only the final sum rounds, ~0.5 ULP
+ *   error.
+ */
+template <bool kHigh, typename V>
+NPSR_INTRIN V HypotSqrt(V a, V b) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+
+  if constexpr (kHigh) {
+    V a_lo, b_lo;
+    V a_hi = TwoProd(a, a, a_lo);
+    V b_hi = TwoProd(b, b, b_lo);
+    V s_hi = Add(a_hi, b_hi);
+    V s_lo = Add(Sub(a_hi, s_hi), b_hi);
+    s_lo = Add(s_lo, Add(a_lo, b_lo));
+    V r = Sqrt(s_hi);
+    V resid;
+    if constexpr (kNativeFMA) {
+      resid = NegMulAdd(r, r, s_hi);
+    } else {
+      V rr_lo;
+      V rr_hi = TwoProd(r, r, rr_lo);
+      resid = Sub(Sub(s_hi, rr_hi), rr_lo);
+    }
+    resid = Add(resid, s_lo);
+    // r = 0 only with a zero residual, the divisor keeps 0/0 out
+    const V div = Max(r, Set(d, std::numeric_limits<T>::min()));
+    return MulAdd(Div(resid, div), Set(d, static_cast<T>(0.5)), r);
+  } else {
+    return Sqrt(MulAdd(a, a, Mul(b, b)));
+  }
+}
+
+/**
+ * This function computes hypot(x, y) = √(x² + y²) of finite x and y.
+ *
+ * With kScale the larger magnitude is brought to [1, 2) by a power of two
+ * built from its exponent field, clamped so the factor and its inverse are
+ * both normal, which leaves [2, 4) at the top of the range and subnormals
+ * below 1, and the root is scaled back by the inverse. Both products are
+ * exact, a smaller magnitude that underflows is negligible against the
+ * larger, so no intermediate overflows or underflows and subnormal inputs
+ * keep their accuracy. Without it x² + y² must stay within the normal range.
+ *
+ * Float's high tier widens to the double low tier instead, where the squares
+ * of any float neither overflow nor underflow and the ~2^-52 error rounds
+ * away, ~0.5 ULP error.
+ */
+template <bool kHigh, bool kScale, typename V>
+NPSR_INTRIN V HypotKernel(V x, V y) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using TI = hwy::MakeSigned<T>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr int kBias = exponential::kExpBias<T>;
+
+  V ax = Abs(x);
+  V ay = Abs(y);
+  if constexpr (kHigh && std::is_same_v<T, float>) {
+    const Half<decltype(d)> dh;
+    const RepartitionToWide<decltype(d)> dw;
+    auto lo = DemoteTo(dh, HypotSqrt<false>(PromoteLowerTo(dw, ax),
+                                            PromoteLowerTo(dw, ay)));
+    auto up = DemoteTo(dh, HypotSqrt<false>(PromoteUpperTo(dw, ax),
+                                            PromoteUpperTo(dw, ay)));
+    return Combine(d, up, lo);
+  } else {
+    V a = Max(ax, ay);
+    V b = Min(ax, ay);
+    if constexpr (kScale) {
+      auto e = ShiftRight<hwy::MantissaBits<T>()>(BitCast(di, a));
+      e = Min(Max(e, Set(di, TI{1})), Set(di, static_cast<TI>(2 * kBias - 1)));
+      e = Sub(e, Set(di, static_cast<TI>(kBias)));
+      const V scale = exponential::Pow2I(d, Neg(e));
+      const V ret = HypotSqrt<kHigh>(Mul(a, scale), Mul(b, scale));
+      return Mul(ret, exponential::Pow2I(d, e));
+    } else {
+      return HypotSqrt<kHigh>(a, b);
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::power
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_POWER_HYPOT_INL_H_
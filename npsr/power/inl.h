@@ -0,0 +1,571 @@
+// Power function dispatcher for Highway SIMD library
+// This file provides the public API for x^y with configurable precision,
+// special case handling and subnormal mode
+//
+// Vectors whose exponents are all 1, 2, -1, 0.5 or small integers take a
+// fast path, the others go through a double-word log(x) and exp of its
+// product with y, whose tier follows the exponential:
+// 1. Low precision: ~1 ULP error, polynomial exp over |r| ≤ ln2/2
+// 2. High precision: ~0.65 ULP error, 2^(j/32) table with a short polynomial
+//
+// Cbrt splits the exponent by three with integer arithmetic and refines a
+// polynomial seed by Newton's iteration, see CbrtKernel<>.
+//
+// Hypot scales both inputs by a power of two taken from the exponent bits
+// of the larger one, see HypotKernel<>:
+// 1. Low precision: ~1 ULP error (~1.2 ULP without native FMA), one
+//    rounded sum of squares
+// 2. High precision: ~0.5 ULP error, exact squares and a corrected root
+
+#if defined(NPSR_POWER_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POWER_INL_H_
+#undef NPSR_POWER_INL_H_
+#else
+#define NPSR_POWER_INL_H_
+#endif
+
+#include <limits>
+
+#include "npsr/exponential/inl.h"  // kInputBound
+#include "npsr/hwy.h"
+#include "npsr/power/cbrt-inl.h"  // Cube root kernel
+#include "npsr/power/hypot-inl.h"  // Scaled sum of squares
+#include "npsr/power/pow-inl.h"   // Double-word log and exp kernels
+#include "npsr/precise.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::power {
+
+/**
+ * Raises overflow and underflow for the lanes of a result computed from the
+ * regular inputs is_regular, and flushes subnormal results to zero under
+ * Subnormal::kFTZ.
+ */
+template <typename Prec, typename V, typename M>
+NPSR_INTRIN V FinishRange(Prec &prec, V ret, M is_regular) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  (void)prec;
+  (void)is_regular;
+
+  const auto is_tiny = Lt(Abs(ret), Set(d, std::numeric_limits<T>::min()));
+  if constexpr (Prec::kExceptions) {
+    int flags = !AllFalse(d, And(is_regular, IsInf(ret)))
+                    ? FPExceptions::kOverflow
+                    : 0;
+    flags |= !AllFalse(d, And(is_regular, is_tiny)) ? FPExceptions::kUnderflow
+                                                     : 0;
+    prec.Raise(flags);
+  }
+  if constexpr (Prec::kFTZ) {
+    ret = IfThenElse(is_tiny, CopySignToAbs(Zero(d), ret), ret);
+  }
+  return ret;
+}
+
+/**
+ * @brief Unified power implementation
+ *
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * Fast paths, each taken only when every lane of y agrees:
+ * - y = 1 returns x, y = 2 returns x·x, y = -1 returns 1/x and y = 0.5
+ *   returns √x with pow's -0 and -∞ cases, all correctly rounded.
+ * - Integer y with |y| ≤ kMaxIntExponent uses PowInt<>, falling back to the
+ *   general path when a lane nears the ends of the normal range.
+ *
+ * The general path works on |x| and restores the sign for odd integer y. With
+ * kSpecialCases:
+ * - Subnormal x are scaled into the normal range, their exponent compensated,
+ *   unless Subnormal::kDAZ, where they read as zero. The LargeArgument branch
+ *   policy decides whether the scaling is skipped for vectors without such
+ *   lanes.
+ * - The product y·log|x| is clamped to the bounds of exp, whose edges are
+ *   redone with Ldexp<>, or LdexpFTZ<> under Subnormal::kFTZ.
+ * - The IEEE 754 special cases: x^±0 and 1^y are 1 even for NaN, (-1)^±∞ is
+ *   1, ±0 and ±∞ give 0 or ∞ signed as x for odd integer y, ±∞ exponents
+ *   give 0 or ∞ by whether |x| > 1, NaN propagates otherwise, and negative
+ *   finite x with finite non-integer y gives NaN.
+ * - Invalid, divide-by-zero (0^y, y < 0 finite), overflow and underflow are
+ *   raised unless kNoExceptions.
+ * With kNoSpecialCases, x must be finite and nonzero, y finite, and the
+ * result normal, others are unspecified.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Power(Prec &prec, V x, V y) {
+  using namespace hn;
+  using T = TFromV<V>;
+  using VI = Vec<RebindToSigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  const V zero = Zero(d);
+  const V one = Set(d, static_cast<T>(1.0));
+  const V min = Set(d, std::numeric_limits<T>::min());
+  (void)prec;
+
+  if constexpr (Prec::kSpecialCases && Prec::kDAZ) {
+    x = IfThenElse(Lt(Abs(x), min), CopySignToAbs(zero, x), x);
+  }
+  const auto is_regular = And(And(IsFinite(x), Ne(x, zero)), IsFinite(y));
+
+  if (AllTrue(d, Eq(y, one))) {
+    return x;
+  }
+  if (AllTrue(d, Eq(y, Set(d, static_cast<T>(2.0))))) {
+    V ret = Mul(x, x);
+    if constexpr (Prec::kSpecialCases) {
+      ret = FinishRange(prec, ret, is_regular);
+    }
+    return ret;
+  }
+  if (AllTrue(d, Eq(y, Set(d, static_cast<T>(-1.0))))) {
+    V ret = Div(one, x);
+    if constexpr (Prec::kSpecialCases) {
+      ret = FinishRange(prec, ret, is_regular);
+      if constexpr (Prec::kExceptions) {
+        prec.Raise(!AllFalse(d, Eq(x, zero)) ? FPExceptions::kDivByZero : 0);
+      }
+    }
+    return ret;
+  }
+  if (AllTrue(d, Eq(y, Set(d, static_cast<T>(0.5))))) {
+    // Adding +0 turns √-0 into +0
+    V ret = Add(Sqrt(x), zero);
+    if constexpr (Prec::kSpecialCases) {
+      const V inf = Inf(d);
+      const auto is_invalid = And(Lt(x, zero), Ne(x, Neg(inf)));
+      ret = IfThenElse(Eq(x, Neg(inf)), inf, ret);
+      if constexpr (Prec::kExceptions) {
+        prec.Raise(!AllFalse(d, is_invalid) ? FPExceptions::kInvalid : 0);
+      }
+    }
+    return ret;
+  }
+
+  const auto is_int = Eq(Round(y), y);
+  const V y_half = Mul(y, Set(d, static_cast<T>(0.5)));
+  const auto is_odd = And(is_int, Ne(Round(y_half), y_half));
+  if (AllTrue(d, And(is_int, Le(Abs(y), Set(d, static_cast<T>(
+                                                  kMaxIntExponent)))))) {
+    Mask<decltype(d)> is_accurate;
+    V ret = PowInt(x, y, is_accurate);
+    if (HWY_LIKELY(AllTrue(d, is_accurate))) {
+      return ret;
+    }
+  }
+
+  V ax = Abs(x);
+  VI k_adj = Zero(di);
+  if constexpr (Prec::kSpecialCases && !Prec::kDAZ) {
+    const auto is_sub = And(Gt(ax, zero), Lt(ax, min));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_sub))) {
+      constexpr int kShift = hwy::MantissaBits<T>() + 1;
+      const V scale = Set(d, kIsSingle ? 0x1p24f : 0x1p53);
+      ax = IfThenElse(is_sub, Mul(ax, scale), ax);
+      k_adj = IfThenElseZero(RebindMask(di, is_sub), Set(di, -kShift));
+    }
+  }
+
+  constexpr auto kBound =
+      exponential::kInputBound<exponential::Operation::kExp, T>;
+  VI m;
+  V e = PowKernel<Prec::kHighAccuracy, Prec::kSpecialCases>(
+      ax, y, k_adj, m, Set(d, kBound[0]), Set(d, kBound[1]));
+  V ret = exponential::LdexpFast(e, m);
+
+  if constexpr (Prec::kSpecialCases) {
+    const auto is_edge = RebindMask(
+        d, Gt(Abs(m), Set(di, exponential::kExpBias<T> - 2)));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_edge))) {
+      V edge;
+      if constexpr (Prec::kFTZ) {
+        edge = exponential::LdexpFTZ(e, m);
+      } else {
+        edge = exponential::Ldexp(e, m);
+      }
+      ret = IfThenElse(is_edge, edge, ret);
+      ret = FinishRange(prec, ret, is_regular);
+    }
+  }
+  ret = IfThenElse(And(is_odd, Lt(x, zero)), Neg(ret), ret);
+
+  if constexpr (Prec::kSpecialCases) {
+    const V inf = Inf(d);
+    const auto is_invalid =
+        AndNot(is_int, And(And(Lt(x, zero), IsFinite(x)), IsFinite(y)));
+    const auto is_pole = And(Eq(x, zero), And(Lt(y, zero), IsFinite(y)));
+    // ±0, ±∞ and ±∞ exponents: ∞ when |x| > 1 and y > 0 or the reverse
+    const auto is_extreme = Or(Or(Eq(x, zero), IsInf(x)), IsInf(y));
+    V extreme = IfThenElseZero(Xor(Gt(ax, one), Lt(y, zero)), inf);
+    extreme = IfThenElse(is_odd, CopySignToAbs(extreme, x), extreme);
+    ret = IfThenElse(is_extreme, extreme, ret);
+    ret = IfThenElse(is_invalid, NaN(d), ret);
+    ret = IfThenElse(Or(IsNaN(x), IsNaN(y)), Add(x, y), ret);
+    const auto is_one =
+        Or(Or(Eq(y, zero), Eq(x, one)), And(IsInf(y), Eq(Abs(x), one)));
+    ret = IfThenElse(is_one, one, ret);
+    if constexpr (Prec::kExceptions) {
+      int flags = !AllFalse(d, is_invalid) ? FPExceptions::kInvalid : 0;
+      flags |= !AllFalse(d, is_pole) ? FPExceptions::kDivByZero : 0;
+      prec.Raise(flags);
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Applies Power over contiguous arrays.
+ *
+ * The remainder is handled with a partial load/store, its padding is set to
+ * one so it never raises and keeps the fast paths of y.
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void PowerArray(Prec &prec, const T *x, const T *y, size_t count,
+                            T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Power(prec, LoadU(d, x + i), LoadU(d, y + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    const auto is_valid = FirstN(d, remaining);
+    const Vec<decltype(d)> one = Set(d, static_cast<T>(1.0));
+    const Vec<decltype(d)> xv =
+        IfThenElse(is_valid, LoadN(d, x + i, remaining), one);
+    const Vec<decltype(d)> yv =
+        IfThenElse(is_valid, LoadN(d, y + i, remaining), Set(d, y[i]));
+    StoreN(Power(prec, xv, yv), d, out + i, remaining);
+  }
+}
+
+/**
+ * @brief Unified cube root implementation
+ *
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * Works on |x| and restores the sign last, the cube root being odd. With
+ * kSpecialCases:
+ * - ±0, ±∞ and NaN are returned as they are, no exception is raised.
+ * - Subnormal x are scaled by 2^54 (double) or 2^24 (float) into the normal
+ *   range and the result by 2^-18 or 2^-8, unless Subnormal::kDAZ, where
+ *   they read as zero. The LargeArgument branch policy decides whether the
+ *   scaling is skipped for vectors without such lanes. The result is never
+ *   subnormal, so Subnormal::kFTZ has no effect.
+ * With kNoSpecialCases, x must be finite, nonzero and normal, others are
+ * unspecified.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V CubeRoot(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  (void)prec;
+
+  V ax = Abs(x);
+  V ret;
+  if constexpr (Prec::kSpecialCases) {
+    const V zero = Zero(d);
+    const V min = Set(d, std::numeric_limits<T>::min());
+    const auto is_sub = And(Gt(ax, zero), Lt(ax, min));
+    // Zeros, subnormals under DAZ and ±∞ hold 1 meanwhile, a normal input
+    const auto is_zero = Prec::kDAZ ? Lt(ax, min) : Eq(ax, zero);
+    const auto is_extreme = Or(is_zero, IsInf(ax));
+    V in = IfThenElse(is_extreme, Set(d, static_cast<T>(1.0)), ax);
+    if constexpr (!Prec::kDAZ) {
+      if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_sub))) {
+        const V scale = Set(d, kIsSingle ? 0x1p24f : 0x1p54);
+        const V unscale = Set(d, kIsSingle ? 0x1p-8f : 0x1p-18);
+        in = IfThenElse(is_sub, Mul(in, scale), in);
+        ret = CbrtKernel<Prec::kHighAccuracy>(in);
+        ret = IfThenElse(is_sub, Mul(ret, unscale), ret);
+      } else {
+        ret = CbrtKernel<Prec::kHighAccuracy>(in);
+      }
+    } else {
+      (void)is_sub;
+      ret = CbrtKernel<Prec::kHighAccuracy>(in);
+    }
+    ret = IfThenElse(is_extreme, IfThenElse(is_zero, zero, ax), ret);
+  } else {
+    ret = CbrtKernel<Prec::kHighAccuracy>(ax);
+  }
+  ret = CopySignToAbs(ret, x);
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(IsNaN(x), x, ret);
+  }
+  return ret;
+}
+
+/**
+ * @brief Unified hypot implementation
+ *
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * With kSpecialCases:
+ * - Both inputs are scaled by HypotKernel<>, so finite results never
+ *   overflow or underflow in between.
+ * - hypot(±∞, y) = +∞ even for NaN y, and NaN propagates otherwise.
+ * - Overflow and underflow are raised unless kNoExceptions, the latter only
+ *   when both inputs are nonzero, as hypot(x, ±0) = |x| is exact.
+ * - Subnormal inputs read as zero under Subnormal::kDAZ, and subnormal
+ *   results flush to zero under Subnormal::kFTZ.
+ * With kNoSpecialCases, x and y must be finite and x² + y² within the
+ * normal range, which skips the scaling, others are unspecified.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Hypotenuse(Prec &prec, V x, V y) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  (void)prec;
+
+  if constexpr (Prec::kSpecialCases && Prec::kDAZ) {
+    const V min = Set(d, std::numeric_limits<T>::min());
+    x = IfThenZeroElse(Lt(Abs(x), min), x);
+    y = IfThenZeroElse(Lt(Abs(y), min), y);
+  }
+  V ret = HypotKernel<Prec::kHighAccuracy, Prec::kSpecialCases>(x, y);
+
+  if constexpr (Prec::kSpecialCases) {
+    const V zero = Zero(d);
+    const auto is_regular = And(And(IsFinite(x), IsFinite(y)),
+                                And(Ne(x, zero), Ne(y, zero)));
+    ret = FinishRange(prec, ret, is_regular);
+    ret = IfThenElse(Or(IsNaN(x), IsNaN(y)), Add(x, y), ret);
+    ret = IfThenElse(Or(IsInf(x), IsInf(y)), Inf(d), ret);
+  }
+  return ret;
+}
+
+/**
+ * @brief Applies Hypotenuse over contiguous arrays.
+ *
+ * The remainder is handled with a partial load/store, its zero padding never
+ * raises.
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void HypotArray(Prec &prec, const T *x, const T *y, size_t count,
+                            T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(Hypotenuse(prec, LoadU(d, x + i), LoadU(d, y + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(Hypotenuse(prec, LoadN(d, x + i, remaining),
+                      LoadN(d, y + i, remaining)),
+           d, out + i, remaining);
+  }
+}
+
+/**
+ * @brief Magnitude of interleaved complex numbers, hypot(re, im)
+ *
+ * Full vectors are split into real and imaginary parts by LoadInterleaved2.
+ * The remainder loads up to two partial vectors and deinterleaves them with
+ * ConcatEven/ConcatOdd; its zero padding never raises.
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void ComplexAbsArray(Prec &prec, const T *in, size_t count,
+                                 T *out) {
+  using namespace hn;
+  using V = Vec<ScalableTag<T>>;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    V re, im;
+    LoadInterleaved2(d, in + 2 * i, re, im);
+    StoreU(Hypotenuse(prec, re, im), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    const size_t scalars = 2 * remaining;
+    const V v0 = LoadN(d, in + 2 * i, scalars);
+    const V v1 = LoadN(d, in + 2 * i + N, scalars > N ? scalars - N : 0);
+    StoreN(Hypotenuse(prec, ConcatEven(d, v1, v0), ConcatOdd(d, v1, v0)), d,
+           out + i, remaining);
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::power
+
+// Public API in the main npsr namespace
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Compute x^y of vector elements with configurable precision
+ *
+ * Evaluates e^(y·log|x|) with the logarithm and the product kept as
+ * double-words, so only the exponential rounds. Error: ~0.65 ULP by default,
+ * ~1 ULP with kLowAccuracy, which drops the exponential's table lookup.
+ * Vectors whose y are all 1, 2, -1, 0.5 or small integers skip the
+ * logarithm for a cheaper correctly rounded or double-word path.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Base vector
+ * @param y      Exponent vector
+ * @return       x^y for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kNoSpecialCases};
+ * auto result = Pow(prec, base_vector, exponent_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Pow(Prec &prec, V x, V y) {
+  return power::Power(prec, x, y);
+}
+
+/**
+ * @brief Compute x^y over arrays with configurable precision
+ *
+ * @param prec   Precise object managing FP environment
+ * @param x      Base array of count elements
+ * @param y      Exponent array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be x or y itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Pow(Prec &prec, const T *x, const T *y, size_t count, T *out) {
+  power::PowerArray(prec, x, y, count, out);
+}
+
+
+/**
+ * @brief Compute the cube root of vector elements with configurable precision
+ *
+ * The exponent is divided by three with integer arithmetic, its remainder
+ * picks 2^(k/3) from a small table, and cbrt of the mantissa comes from a
+ * polynomial seed refined by Newton's iteration. Error: ~0.5 ULP by default
+ * with perfect cubes exact, ~1.5 ULP with kLowAccuracy (~2 ULP without
+ * native FMA), which stays in float for float and takes a second plain
+ * Newton step instead of the exact residual for double.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       cbrt(x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoSpecialCases};
+ * auto result = Cbrt(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Cbrt(Prec &prec, V x) {
+  return power::CubeRoot(prec, x);
+}
+
+/**
+ * @brief Compute the cube root over an array with configurable precision
+ *
+ * The remainder is handled with a partial load/store.
+ *
+ * @param prec   Precise object managing FP environment
+ * @param in     Input array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be in itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Cbrt(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(power::CubeRoot(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(power::CubeRoot(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+/**
+ * @brief Compute hypot(x, y) = √(x² + y²) of vector elements with
+ * configurable precision
+ *
+ * Both inputs are scaled by a power of two built from the exponent bits of
+ * the larger one, so no intermediate overflows or underflows. Error: ~0.5 ULP
+ * by default, the squares kept exact and the root corrected by its exact
+ * residual, ~1 ULP with kLowAccuracy (~1.2 ULP without native FMA), which
+ * rounds the sum of squares.
+ * kNoSpecialCases also drops the scaling, for inputs whose squares stay
+ * within the normal range.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      First input vector
+ * @param y      Second input vector
+ * @return       hypot(x, y) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy, kNoSpecialCases};
+ * auto result = Hypot(prec, x_vector, y_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Hypot(Prec &prec, V x, V y) {
+  return power::Hypotenuse(prec, x, y);
+}
+
+/**
+ * @brief Compute hypot(x, y) over arrays with configurable precision
+ *
+ * @param prec   Precise object managing FP environment
+ * @param x      First input array of count elements
+ * @param y      Second input array of count elements
+ * @param count  Number of elements
+ * @param out    Output array of count elements, may be x or y itself
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Hypot(Prec &prec, const T *x, const T *y, size_t count,
+                       T *out) {
+  power::HypotArray(prec, x, y, count, out);
+}
+
+/**
+ * @brief Compute the magnitude of interleaved complex numbers
+ *
+ * The equivalent of np.abs over complex64 (T = float) or complex128
+ * (T = double) data: `in` holds `count` (real, imaginary) pairs and
+ * out[i] = hypot(in[2i], in[2i + 1]), without deinterleaving into
+ * temporary buffers first. `out` may be `in` itself, the magnitudes then
+ * fill its first `count` elements.
+ *
+ * @example
+ * ```cpp
+ * std::complex<double> spectrum[n];
+ * ComplexAbs(prec, reinterpret_cast<const double *>(spectrum), n, magnitude);
+ * ```
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void ComplexAbs(Prec &prec, const T *in, size_t count, T *out) {
+  power::ComplexAbsArray(prec, in, count, out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_POWER_INL_H_
@@ -0,0 +1,127 @@
+#if defined(NPSR_POWER_POW_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_POWER_POW_INL_H_
+#undef NPSR_POWER_POW_INL_H_
+#else
+#define NPSR_POWER_POW_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"               // TwoProd, MulDW
+#include "npsr/exponential/exp-inl.h"  // Reduce, ExpReduced
+#include "npsr/hwy.h"
+#include "npsr/logarithm/log-inl.h"  // LogKernelDW
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::power {
+
+// Largest |y| of the integer fast path. Past it, or past 4 when the double-
+// word products have no native FMA, the squarings cost more than log and exp.
+constexpr int kMaxIntExponent = kNativeFMA ? 16 : 4;
+
+/**
+ * This function computes x^y for integer valued |y| ≤ kMaxIntExponent by
+ * binary powering on a double-word, so each step rounds ~2^-digits below
+ * the result and the final sum rounds once, ~0.5 ULP error. Negative y take
+ * the reciprocal of the power with one Newton correction.
+ *
+ * The double-word loses its low part near the subnormal range and ±∞, ±0
+ * and NaN don't survive the error terms, so is_accurate reports the lanes
+ * whose power and result stayed within [2^digits·min, max]. The loop runs
+ * over the bits of the largest |y| in the vector.
+ */
+template <typename V, typename M>
+NPSR_INTRIN V PowInt(V x, V y, M &is_accurate) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  auto n = ConvertTo(di, Abs(y));
+  V p_hi = one;
+  V p_lo = Zero(d);
+  V b_hi = x;
+  V b_lo = Zero(d);
+  for (auto bits = ReduceMax(di, n);;) {
+    const auto is_odd = RebindMask(d, Ne(And(n, Set(di, 1)), Zero(di)));
+    V m_lo;
+    V m_hi = MulDW(p_hi, p_lo, b_hi, b_lo, m_lo);
+    p_hi = IfThenElse(is_odd, m_hi, p_hi);
+    p_lo = IfThenElse(is_odd, m_lo, p_lo);
+    bits >>= 1;
+    if (bits == 0) {
+      break;
+    }
+    n = ShiftRight<1>(n);
+    b_hi = MulDW(b_hi, b_lo, b_hi, b_lo, b_lo);
+  }
+
+  V ret = Add(p_hi, p_lo);
+  const auto is_neg = Lt(y, Zero(d));
+  if (!AllFalse(d, is_neg)) {
+    // 1/p·(1 + e), e = 1 - p·q with p·q ≈ 1, so 1 - p·q_hi is exact
+    V q = Div(one, p_hi);
+    V pq_lo;
+    V pq_hi = TwoProd(p_hi, q, pq_lo);
+    V e = NegMulAdd(p_lo, q, Sub(Sub(one, pq_hi), pq_lo));
+    ret = IfThenElse(is_neg, MulAdd(q, e, q), ret);
+  }
+
+  const V tiny = Set(d, kIsSingle ? 0x1p-102f : 0x1p-969);
+  const V inf = Inf(d);
+  const V ap = Abs(p_hi);
+  const V ar = Abs(ret);
+  is_accurate = And(And(Ge(ap, tiny), Lt(ap, inf)),
+                    And(Ge(ar, tiny), Lt(ar, inf)));
+  return ret;
+}
+
+/**
+ * This function computes |x|^y = e^(y·log|x|) as 2^m·e, for a positive
+ * normal ax, whose exponent k_adj corrects after prescaling by the caller.
+ *
+ * Algorithm Overview:
+ * 1. Logarithm: log(ax) as a double-word l_hi + l_lo, see LogKernelDW<>
+ *
+ * 2. Product: t = y·l as a double-word, see TwoProd<>. The relative error
+ *    ε of the logarithm becomes the absolute error |t|·ε of t, which
+ *    |t| < 745 keeps below 2^-4 ULP of the result
+ *
+ * 3. Exponential: t_hi is reduced as for exp, see exponential::Reduce<>,
+ *    and t_lo joins the reduced argument before exponential::ExpReduced<>,
+ *    ~0.55 ULP error with kTable and ~1-1.3 ULP without.
+ *
+ * With kClamp, t_hi is clamped to the given bounds, dropping t_lo, so ±∞
+ * and overflowing products scale 2^m only as far as Ldexp<> can split.
+ */
+template <bool kTable, bool kClamp, typename V, typename VI>
+NPSR_INTRIN V PowKernel(V ax, V y, VI k_adj, VI &m, V lower, V upper) {
+  using namespace hn;
+  using exponential::Operation;
+
+  V l_lo;
+  V l_hi = logarithm::LogKernelDW(ax, k_adj, l_lo);
+  V t_lo;
+  V t_hi = TwoProd(y, l_hi, t_lo);
+  t_lo = MulAdd(y, l_lo, t_lo);
+  if constexpr (kClamp) {
+    V tc = Min(Max(t_hi, lower), upper);
+    t_lo = IfThenElseZero(Eq(tc, t_hi), t_lo);
+    t_hi = tc;
+  } else {
+    (void)lower;
+    (void)upper;
+  }
+
+  V r_hi, r_lo;
+  VI k = exponential::Reduce<Operation::kExp, kTable>(t_hi, r_hi, r_lo);
+  return exponential::ExpReduced<kTable>(k, Add(r_hi, Add(r_lo, t_lo)), m);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::power
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_POWER_POW_INL_H_
@@ -1,6 +1,7 @@
 #ifndef NPSR_PRECISE_H_
 #define NPSR_PRECISE_H_
 
+#include <algorithm>
 #include <array>
 #include <cfenv>
 #include <string>
@@ -20,12 +21,35 @@ struct _NoSpecialCases {};
 struct _NoExceptions {};  // Disable floating-point exception tracking
 // Use faster, less accurate algorithms (typ. 1-4 ULP vs 1.0 ULP)
 struct _LowAccuracy {};
+// Check at runtime whether every lane of a vector is small enough to skip
+// range reduction, e.g. |x| ≤ π/4 for sine and cosine
+struct _SmallArgument {};
+
+// Accept up to N ULP of error: picks the cheapest approximation whose
+// measured error stays within N. Implies _LowAccuracy when N >= 4, though
+// functions whose low tier exceeds N keep their default tier, e.g. tgamma
+// below N = 8 and lgamma for any N.
+template <int N>
+struct _MaxULP {
+  static_assert(N > 0, "The ULP budget must be positive");
+};
 
 // Convenience constants for cleaner API
 constexpr auto kNoLargeArgument = _NoLargeArgument{};
 constexpr auto kNoSpecialCases = _NoSpecialCases{};
 constexpr auto kNoExceptions = _NoExceptions{};
 constexpr auto kLowAccuracy = _LowAccuracy{};
+constexpr auto kSmallArgument = _SmallArgument{};
+template <int N>
+constexpr auto kMaxULP = _MaxULP<N>{};
+
+namespace detail {
+// ULP budget carried by a tag, 0 for tags that are not _MaxULP
+template <typename T>
+constexpr int kMaxULPOf = 0;
+template <int N>
+constexpr int kMaxULPOf<_MaxULP<N>> = N;
+}  // namespace detail
 
 // Subnormal (denormal) number handling modes
 // Controls how the CPU handles numbers smaller than the minimum normalized
@@ -41,6 +65,25 @@ struct Subnormal {
   static constexpr auto kIEEE754 = _IEEE754{};
 };
 
+// Policy for lanes that need the extended precision (Payne-Hanek) reduction
+// Trades average throughput against a bounded worst case per call. Functions
+// whose documentation says so apply it to their rare-lane fix-ups as well:
+// only kBranchy skips them for vectors without such lanes
+struct LargeArgument {
+  // Branch to the extended path only when a lane needs it (default)
+  struct _Branchy {};
+  // Always compute the extended path and blend, no data dependent branch
+  struct _Branchless {};
+  // Never take the extended path: a longer Cody-Waite reduction without
+  // table lookups is always computed and blended instead. Fixed and lower
+  // cost, valid for |x| < 2^46, see Trig()
+  struct _NeverExtended {};
+
+  static constexpr auto kBranchy = _Branchy{};
+  static constexpr auto kBranchless = _Branchless{};
+  static constexpr auto kNeverExtended = _NeverExtended{};
+};
+
 // Floating-point exception flags
 // These match the standard C library FE_* macros
 class FPExceptions {
@@ -111,7 +154,15 @@ class FPExceptions {
  * Configuration options:
  * - kLowAccuracy: Use faster algorithms with ~1-4 ULP error (default: high
  * accuracy ~1.0 ULP)
+ * - kMaxULP<N>: Accept up to N ULP error, trading accuracy for shorter
+ * polynomials (e.g. kMaxULP<4096> for graphics or audio)
  * - kNoLargeArgument: Skip extended precision reduction for large arguments
+ * - LargeArgument::kBranchy/kBranchless/kNeverExtended: How lanes with large
+ * arguments reach the extended precision reduction: branch when needed
+ * (default), always compute and blend, or never (a cheaper reduction of
+ * bounded range, always blended)
+ * - kSmallArgument: Take a reduction-free path when every lane of the vector
+ * is small, worth it when inputs are mostly small (e.g. physics loops)
  * - kNoSpecialCases: Skip NaN/Inf handling (assumes finite inputs)
  * - kNoExceptions: Disable FP exception tracking for better performance
  * - Subnormal::kDAZ/kFTZ: Flush subnormals to zero for performance
@@ -158,11 +209,27 @@ class Precise : public FPExceptions {
   // Compile-time configuration queries
   // These allow algorithms to optimize based on precision requirements
   static constexpr bool kNoExceptions = (is_same_v<_NoExceptions, Args> || ...);
+  static constexpr bool kBranchless =
+      (is_same_v<LargeArgument::_Branchless, Args> || ...);
+  static constexpr bool kNeverExtended =
+      (is_same_v<LargeArgument::_NeverExtended, Args> || ...);
+  static constexpr bool _kBranchy =
+      (is_same_v<LargeArgument::_Branchy, Args> || ...);
+  static_assert(int{_kBranchy} + int{kBranchless} + int{kNeverExtended} <= 1,
+                "Only one LargeArgument policy can be specified");
+  static constexpr bool kBranchy = !kBranchless && !kNeverExtended;
+
   static constexpr bool kNoLargeArgument =
       (is_same_v<_NoLargeArgument, Args> || ...);
   static constexpr bool kNoSpecialCases =
       (is_same_v<_NoSpecialCases, Args> || ...);
-  static constexpr bool kLowAccuracy = (is_same_v<_LowAccuracy, Args> || ...);
+  static constexpr bool kSmallArgument =
+      (is_same_v<_SmallArgument, Args> || ...);
+  // Largest ULP budget among the kMaxULP<N> tags, 0 when none is given
+  static constexpr int kMaxULPBudget =
+      std::max({0, detail::kMaxULPOf<Args>...});
+  static constexpr bool kLowAccuracy =
+      (is_same_v<_LowAccuracy, Args> || ...) || kMaxULPBudget >= 4;
 
   // Derived flags (defaults when not explicitly specified)
   static constexpr bool kHighAccuracy = !kLowAccuracy;
@@ -27,6 +27,12 @@ template <> inline constexpr float kPiMul2<float>[] = {
 template <> inline constexpr double kPiMul2<double>[] = {
 0x1.921fb54442d18p2, 0x1.1a62633145c07p-52, };
 
+template <typename T> inline constexpr char kPiDiv180[] = {};
+template <> inline constexpr float kPiDiv180<float>[] = {
+0x1.1df46ap-6f, 0x1.294e9cp-33f, };
+template <> inline constexpr double kPiDiv180<double>[] = {
+0x1.1df46a2529d39p-6, 0x1.5c1d8becdd291p-62, };
+
 template <bool FMA> inline constexpr double kPiDiv16Prec29[] = {
 0x1.921fb54442d18p-3, 0x1.1a62633p-57, 0x1.45c06e0e68948p-89, };
 template <> inline constexpr double kPiDiv16Prec29<false>[] = {
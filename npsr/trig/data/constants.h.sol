@@ -59,6 +59,15 @@ Append(
   
   "template <> inline constexpr double kPiMul2<double>[] = " @
   KArray_(Float64, pi*2, [|RN, 53, 53|]),  // 2x53-bit pieces
+  "",
+
+  // π/180 as hi + lo, turns exactly reduced degrees into radians
+  "template <typename T> inline constexpr char kPiDiv180[] = {};",
+  "template <> inline constexpr float kPiDiv180<float>[] = " @
+  KArray_(Float32, pi/180, [|RN, 24, 24|]),
+
+  "template <> inline constexpr double kPiDiv180<double>[] = " @
+  KArray_(Float64, pi/180, [|RN, 53, 53|]),
   "" 
 );
 
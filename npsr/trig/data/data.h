@@ -4,10 +4,14 @@
 // Intentionally NOT guarded with #ifndef: it pulls in the Highway target-toggled
 // header kpi16-inl.h, which must be re-included once per SIMD target via
 // hwy/foreach_target.h. An include-once guard would suppress all but the first
-// target pass. The include-once children (constants/approx/reduction) carry
-// their own guards and no-op on re-entry.
+// target pass. The include-once children (constants/approx/ladder/small/tan/
+// reduction/sinc) carry their own guards and no-op on re-entry.
 #include "npsr/lut-inl.h"
 #include "npsr/trig/data/constants.h"
 #include "npsr/trig/data/kpi16-inl.h"
 #include "npsr/trig/data/approx.h"
+#include "npsr/trig/data/ladder.h"
+#include "npsr/trig/data/small.h"
+#include "npsr/trig/data/tan.h"
 #include "npsr/trig/data/reduction.h"
+#include "npsr/trig/data/sinc.h"
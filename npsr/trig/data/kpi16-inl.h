@@ -35,7 +35,31 @@ inline constexpr auto kKPi16Table = MakeLut<double>(
 }
 
 );
-inline HWY_ATTR void _dummy_suppress_unused_target(){}
+inline constexpr auto kTanKPi16TableF32 = MakeLut<float>(
+// High parts of tan(k·π/16) where k = -4, -3, ..., 3
+{
+-0x1p0f, -0x1.561b82p-1f, -0x1.a8279ap-2f, -0x1.975f5ep-3f, 
+0.0f, 0x1.975f5ep-3f, 0x1.a8279ap-2f, 0x1.561b82p-1f, 
+},
+// Low parts of tan(k·π/16) where k = -4, -3, ..., 3
+{
+0.0f, -0x1.56ff32p-26f, 0x1.80c434p-28f, -0x1.54c56p-33f, 
+0.0f, 0x1.54c56p-33f, -0x1.80c434p-28f, 0x1.56ff32p-26f, 
+}
+);
+inline constexpr auto kTanKPi16TableF64 = MakeLut<double>(
+// High parts of tan(k·π/16) where k = -4, -3, ..., 3
+{
+-0x1p0, -0x1.561b82ab7f99p-1, -0x1.a827999fcef32p-2, -0x1.975f5e0553158p-3, 
+0.0, 0x1.975f5e0553158p-3, 0x1.a827999fcef32p-2, 0x1.561b82ab7f99p-1, 
+},
+// Low parts of tan(k·π/16) where k = -4, -3, ..., 3
+{
+0.0, -0x1.7a8c52172b675p-55, -0x1.08b2fb1366ea9p-56, -0x1.ef5d367441946p-61, 
+0.0, 0x1.ef5d367441946p-61, 0x1.08b2fb1366ea9p-56, 0x1.7a8c52172b675p-55, 
+}
+);
+inline HWY_ATTR void _dummy_suppress_unused_target_NPSR_TRIG_DATA_KPI16_INL_H(){}
 } // namespace npsr::HWY_NAMESPACE::trig
 HWY_AFTER_NAMESPACE();
 #endif // NPSR_TRIG_DATA_KPI16_INL_H
@@ -68,6 +68,34 @@ procedure PiDivPackLowTable_(pT, pFunc0, pFunc1, pBy) {
   return CArrayT(pT, r, 4);
 };
 
+// Generates tan(k·π/16) for k = -pBy/4, ..., pBy/4 - 1, split into high and
+// low parts, for the tangent kernel
+//
+// Tangent has period π, so the tangent kernel reduces its input to:
+//   x = n·(π/2) + k·(π/16) + r, where -4 ≤ k ≤ 3 and |r| ≤ π/32
+// The odd multiples of π/2 are handled by tan(x + π/2) = -1/tan(x), which
+// keeps every table entry within [-1, 1] and away from the pole.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pBy  - Divisor for π (16 in this case)
+//   pLow - false for the high parts, true for the low parts
+procedure TanPiDivTable_(pT, pBy, pLow) {
+  var r, i, $;
+  $.pi_by = pi / pBy;
+  r = [||];
+  for i from -pBy / 4 to pBy / 4 - 1 do {
+    $.exact = tan(i * $.pi_by);
+    $.hi = pT.kRound($.exact);
+    if (pLow) then {
+      r = r :. pT.kRound($.exact - $.hi);
+    } else {
+      r = r :. $.hi;
+    };
+  };
+  return CArrayT(pT, r, 4);
+};
+
 Append(
   "inline constexpr auto kKPi16Table = MakeLut<double>(",
   "// High parts of sin(k·π/16) where k = 0, 1, ..., 15",
@@ -82,5 +110,20 @@ Append(
   ");"
 );
 
+Append(
+  "inline constexpr auto kTanKPi16TableF32 = MakeLut<float>(",
+  "// High parts of tan(k·π/16) where k = -4, -3, ..., 3",
+  TanPiDivTable_(Float32, 16, false) @ ",",
+  "// Low parts of tan(k·π/16) where k = -4, -3, ..., 3",
+  TanPiDivTable_(Float32, 16, true),
+  ");",
+  "inline constexpr auto kTanKPi16TableF64 = MakeLut<double>(",
+  "// High parts of tan(k·π/16) where k = -4, -3, ..., 3",
+  TanPiDivTable_(Float64, 16, false) @ ",",
+  "// Low parts of tan(k·π/16) where k = -4, -3, ..., 3",
+  TanPiDivTable_(Float64, 16, true),
+  ");"
+);
+
 WriteHighwayHeader("npsr::HWY_NAMESPACE::trig");
 
@@ -0,0 +1,31 @@
+// Auto-generated by npsr/trig/data/ladder.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_TRIG_DATA_LADDER_H
+#define NPSR_TRIG_DATA_LADDER_H
+
+namespace npsr::trig::data {
+// Coefficients of P are stored from the highest degree down (Horner order),
+// the r³ coefficient last.
+template <typename T, int kDeg> inline constexpr char kSinLadder[] = {};
+// degree 5, relative error 2^-12.0625
+template <> inline constexpr float kSinLadder<float, 5>[] = {
+0x1.f37eap-8f, -0x1.542aeep-3f, };
+// degree 7, relative error 2^-19.25
+template <> inline constexpr float kSinLadder<float, 7>[] = {
+-0x1.86416p-13f, 0x1.10841ep-7f, -0x1.5551ecp-3f, };
+// degree 9, relative error 2^-26.125
+template <> inline constexpr double kSinLadder<double, 9>[] = {
+0x1.6003b6916054bp-19, -0x1.9f9a838bc4f14p-13, 0x1.110fbb5c38db2p-7, -0x1.555550b792631p-3, 
+};
+// degree 11, relative error 2^-33.25
+template <> inline constexpr double kSinLadder<double, 11>[] = {
+-0x1.9d46d0070839bp-26, 0x1.7191af9cafba6p-19, -0x1.a018deb37f279p-13, 0x1.11110f5cca24ap-7, 
+-0x1.55555551daf8dp-3, };
+// degree 13, relative error 2^-41.5
+template <> inline constexpr double kSinLadder<double, 13>[] = {
+0x1.55306a0736f3cp-33, -0x1.ae24980ab709ep-26, 0x1.71dd9ee4a2b34p-19, -0x1.a01a004463c7ep-13, 
+0x1.1111110fbea71p-7, -0x1.5555555553afbp-3, };
+
+} // namespace npsr::trig::data
+
+#endif // NPSR_TRIG_DATA_LADDER_H
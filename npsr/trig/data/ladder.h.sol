@@ -0,0 +1,43 @@
+// Generates the minimax polynomials behind the kMaxULP<N> accuracy ladder
+// used by the low precision path (see LowDegree in npsr/trig/low-inl.h).
+//
+// Each rung approximates sin(r) ≈ r + r³·P(r²) on [-π/2, π/2], the range
+// left by the Cody-Waite reduction in Low<>. Cosine reuses the same rung
+// through cos(x) = sin(x + π/2). Lower degrees trade accuracy for latency:
+// every dropped term removes one dependent FMA from the critical path.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Odd degree of the polynomial
+procedure SinRung_(pT, pDeg) {
+  var i, $;
+  $.monos = [||];
+  for i from 3 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.fit = MinimaxCoeffs(pT, sin(x), $.monos, [2^-100; pi/2], x);
+  $.array = CArrayT(pT, $.fit.coeffs, 4);
+  // Degree and error are printed in decimal, the coefficients stay in hex
+  SetDisplay(decimal);
+  $.lines = [|
+    "// degree " @ pDeg @ ", relative error 2^" @ round(log2($.fit.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kSinLadder<" @
+    pT.kCName @ ", " @ pDeg @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+Append(
+  "// Coefficients of P are stored from the highest degree down (Horner order),",
+  "// the r³ coefficient last.",
+  "template <typename T, int kDeg> inline constexpr char kSinLadder[] = {};"
+);
+Append @ SinRung_(Float32, 5);
+Append @ SinRung_(Float32, 7);
+Append @ SinRung_(Float64, 9);
+Append @ SinRung_(Float64, 11);
+Append @ SinRung_(Float64, 13);
+Append("");
+
+WriteCPPHeader("npsr::trig::data");
@@ -0,0 +1,20 @@
+// Auto-generated by npsr/trig/data/sinc.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_TRIG_DATA_SINC_H
+#define NPSR_TRIG_DATA_SINC_H
+
+namespace npsr::trig::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kSincPoly[] = {};
+// sinc degree 8, |x| < 1/4, relative error 2^-35.25
+template <> inline constexpr float kSincPoly<float>[] = {
+0x1.a41d96p-6f, -0x1.8695cap-3f, 0x1.9f9c92p-1f, -0x1.a51a66p0f, 
+};
+// sinc degree 14, |x| < 1/4, relative error 2^-56.75
+template <> inline constexpr double kSincPoly<double>[] = {
+-0x1.5e194d847ee78p-18, 0x1.36ae6972b3ebap-13, -0x1.3380dbf01dd62p-9, 0x1.ac68055be8e52p-6, 
+-0x1.86a8e471e610dp-3, 0x1.9f9cb402bc3b2p-1, -0x1.a51a6625307d3p0, };
+
+} // namespace npsr::trig::data
+
+#endif // NPSR_TRIG_DATA_SINC_H
@@ -0,0 +1,42 @@
+// Generates the minimax polynomial of the normalized sinc near zero
+// (see npsr/trig/pi-inl.h).
+//
+// sin(πx)/(πx) is 0/0 at x = 0, so small arguments take an even polynomial
+// instead of the quotient:
+//   sinc(x) ≈ 1 + x²·P(x²),  |x| < 1/4
+// The leading term is kept exact so the kernel can add it last.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Even degree of the polynomial
+procedure Sinc_(pT, pDeg) {
+  var i, $;
+  $.range = [2^-100; 1/4];
+  $.monos = [||];
+  for i from 2 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.p = MinimaxCoeffs(pT, sin(pi * x) / (pi * x), $.monos, $.range, 1);
+  $.array = CArrayT(pT, $.p.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// sinc degree " @ pDeg @ ", |x| < 1/4, relative error 2^" @
+    round(log2($.p.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kSincPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+suppressmessage(185, 186); // suppress expected info round-up, round-down
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kSincPoly[] = {};"
+);
+Append @ Sinc_(Float32, 8);
+Append @ Sinc_(Float64, 14);
+Append("");
+
+WriteCPPHeader("npsr::trig::data");
@@ -0,0 +1,28 @@
+// Auto-generated by npsr/trig/data/small.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_TRIG_DATA_SMALL_H
+#define NPSR_TRIG_DATA_SMALL_H
+
+namespace npsr::trig::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kSinSmall[] = {};
+template <typename T> inline constexpr char kCosSmall[] = {};
+// sin degree 9, relative error 2^-31.5
+template <> inline constexpr float kSinSmall<float>[] = {
+0x1.8114bp-19f, -0x1.a06acep-13f, 0x1.111182p-7f, -0x1.555556p-3f, 
+};
+// cos degree 8, relative error 2^-31.25
+template <> inline constexpr float kCosSmall<float>[] = {
+0x1.9ae984p-16f, -0x1.6c0fcep-10f, 0x1.55555p-5f, };
+// sin degree 15, relative error 2^-56
+template <> inline constexpr double kSinSmall<double>[] = {
+-0x1.22a882b089067p-42, 0x1.5f449c195cdbap-33, -0x1.ae6210f9d64afp-26, 0x1.71de392778995p-19, 
+-0x1.a01a019f9a3e9p-13, 0x1.1111111110fap-7, -0x1.5555555555555p-3, };
+// cos degree 14, relative error 2^-58
+template <> inline constexpr double kCosSmall<double>[] = {
+-0x1.90661678b9028p-37, 0x1.1eeb5ef5448d1p-29, -0x1.27e4fa27989fap-22, 0x1.a01a019f6c038p-16, 
+-0x1.6c16c16c169e2p-10, 0x1.5555555555555p-5, };
+
+} // namespace npsr::trig::data
+
+#endif // NPSR_TRIG_DATA_SMALL_H
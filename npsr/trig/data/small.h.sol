@@ -0,0 +1,53 @@
+// Generates the minimax polynomials of the small argument fast path
+// (see npsr/trig/small-inl.h), taken when every lane satisfies |x| ≤ π/4.
+//
+// No reduction is needed on that range, so sine and cosine are approximated
+// directly:
+//   sin(x) ≈ x + x³·P(x²)
+//   cos(x) ≈ 1 - x²/2 + x⁴·Q(x²)
+// The leading terms are kept exact so the kernel can add them last.
+//
+// Parameters:
+//   pT      - Type descriptor (Float32 or Float64)
+//   pSinDeg - Odd degree of the sine polynomial
+//   pCosDeg - Even degree of the cosine polynomial
+procedure Small_(pT, pSinDeg, pCosDeg) {
+  var i, $;
+  $.range = [2^-100; pi/4];
+  $.sin_monos = [||];
+  for i from 3 to pSinDeg by 2 do {
+    $.sin_monos = $.sin_monos :. i;
+  };
+  $.cos_monos = [||];
+  for i from 4 to pCosDeg by 2 do {
+    $.cos_monos = $.cos_monos :. i;
+  };
+  $.sin = MinimaxCoeffs(pT, sin(x), $.sin_monos, $.range, x);
+  $.cos = MinimaxCoeffs(pT, cos(x), $.cos_monos, $.range, 1 - x^2/2);
+  $.sin_array = CArrayT(pT, $.sin.coeffs, 4);
+  $.cos_array = CArrayT(pT, $.cos.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// sin degree " @ pSinDeg @ ", relative error 2^" @
+    round(log2($.sin.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kSinSmall<" @
+    pT.kCName @ ">[] = " @ $.sin_array @ ";",
+    "// cos degree " @ pCosDeg @ ", relative error 2^" @
+    round(log2($.cos.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kCosSmall<" @
+    pT.kCName @ ">[] = " @ $.cos_array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kSinSmall[] = {};",
+  "template <typename T> inline constexpr char kCosSmall[] = {};"
+);
+Append @ Small_(Float32, 9, 8);
+Append @ Small_(Float64, 15, 14);
+Append("");
+
+WriteCPPHeader("npsr::trig::data");
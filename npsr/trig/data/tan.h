@@ -0,0 +1,19 @@
+// Auto-generated by npsr/trig/data/tan.h.sol
+// Use `spin sollya -f` to force regeneration
+#ifndef NPSR_TRIG_DATA_TAN_H
+#define NPSR_TRIG_DATA_TAN_H
+
+namespace npsr::trig::data {
+// Coefficients are stored from the highest degree down (Horner order).
+template <typename T> inline constexpr char kTanPoly[] = {};
+// tan degree 7, relative error 2^-37
+template <> inline constexpr float kTanPoly<float>[] = {
+0x1.be86fcp-5f, 0x1.110edap-3f, 0x1.555556p-2f, };
+// tan degree 11, relative error 2^-58
+template <> inline constexpr double kTanPoly<double>[] = {
+0x1.2569dd5fdd433p-7, 0x1.664be062c71cfp-6, 0x1.ba1ba3597d43ep-5, 0x1.11111110eb207p-3, 
+0x1.555555555557cp-2, };
+
+} // namespace npsr::trig::data
+
+#endif // NPSR_TRIG_DATA_TAN_H
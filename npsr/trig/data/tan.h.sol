@@ -0,0 +1,42 @@
+// Generates the minimax polynomials of the tangent kernel
+// (see npsr/trig/tan-inl.h).
+//
+// The argument is reduced to x = n·π/2 + j·π/16 + s, |s| ≤ π/32, and tan(s)
+// is combined with tan(j·π/16) from kTanKPi16Table by the addition formula,
+// so the polynomial only has to cover the short interval:
+//   tan(s) ≈ s + s³·P(s²)
+// The leading term is kept exact so the kernel can add it last. The range
+// is widened slightly to absorb the rounding of j.
+//
+// Parameters:
+//   pT   - Type descriptor (Float32 or Float64)
+//   pDeg - Odd degree of the polynomial
+procedure Tan_(pT, pDeg) {
+  var i, $;
+  $.range = [2^-100; pi/32 * (1 + 2^-10)];
+  $.monos = [||];
+  for i from 3 to pDeg by 2 do {
+    $.monos = $.monos :. i;
+  };
+  $.tan = MinimaxCoeffs(pT, tan(x), $.monos, $.range, x);
+  $.array = CArrayT(pT, $.tan.coeffs, 4);
+  SetDisplay(decimal);
+  $.lines = [|
+    "// tan degree " @ pDeg @ ", relative error 2^" @
+    round(log2($.tan.error), 8, RN),
+    "template <> inline constexpr " @ pT.kCName @ " kTanPoly<" @
+    pT.kCName @ ">[] = " @ $.array @ ";"
+  |];
+  RestoreDisplay();
+  return $.lines;
+};
+
+Append(
+  "// Coefficients are stored from the highest degree down (Horner order).",
+  "template <typename T> inline constexpr char kTanPoly[] = {};"
+);
+Append @ Tan_(Float32, 7);
+Append @ Tan_(Float64, 11);
+Append("");
+
+WriteCPPHeader("npsr::trig::data");
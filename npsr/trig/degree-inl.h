@@ -0,0 +1,168 @@
+#if defined(NPSR_TRIG_DEGREE_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_DEGREE_INL_H_
+#undef NPSR_TRIG_DEGREE_INL_H_
+#else
+#define NPSR_TRIG_DEGREE_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"               // TwoProd
+#include "npsr/exponential/exp-inl.h"  // Pow2I
+#include "npsr/hwy.h"
+#include "npsr/trig/data/data.h"
+#include "npsr/trig/high-inl.h"  // KPi16Reconstruct
+#include "npsr/trig/low-inl.h"   // Operation
+#include "npsr/trig/tan-inl.h"   // TanReduced
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+// Bound of ReduceMod360<>, larger degrees must be folded first
+inline constexpr double kDegreeFoldBound = 0x1p72;
+
+/**
+ * Exact reduction of degrees: y = a - 360·k, |y| ≤ 180, for 0 ≤ a < 2^72.
+ *
+ * Two steps, first modulo 360·2^20 then modulo 360, keep each quotient small
+ * enough for its product with the step to be exact, k < 2^44, and the
+ * difference is exact by Sterbenz's lemma as the quotient is rounded to
+ * nearest. No FMA is needed.
+ */
+template <typename V>
+NPSR_INTRIN V ReduceMod360(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  constexpr double kBigStep = 360.0 * 0x1p20;
+  V k = Round(Mul(a, Set(d, 1.0 / kBigStep)));
+  V y = NegMulAdd(k, Set(d, kBigStep), a);
+  k = Round(Mul(y, Set(d, 1.0 / 360)));
+  return NegMulAdd(k, Set(d, 360.0), y);
+}
+
+/**
+ * Brings a ≥ 2^72 below the bound of ReduceMod360<> without changing a mod
+ * 360. Such a are multiples of 2^19, and 2^12 ≡ 1 (mod 45), so scaling by
+ * 2^-12j keeps the residue as long as the result stays a multiple of 8,
+ * which holds down to 2^60. The scale is picked greedily from 2^-768.
+ */
+template <typename V>
+NPSR_INTRIN V FoldDegrees(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V floor = Set(d, 0x1p60);
+  for (int step = 768; step >= 12; step /= 2) {
+    V scaled = Mul(a, exponential::Pow2I(d, Set(di, -step)));
+    a = IfThenElse(Ge(scaled, floor), scaled, a);
+  }
+  return a;
+}
+
+/**
+ * This function computes sin, cos or tan of a = |x| degrees, the sign of
+ * sine and tangent being restored by the caller.
+ *
+ * Algorithm Overview:
+ * 1. Exact Reduction: y = a mod 360 by ReduceMod360<>, folding huge a
+ *    first under kLargeArgument, then q = round(y/90), t = y - 90·q,
+ *    |t| ≤ 45, exact by Sterbenz's lemma. No Payne-Hanek tier is needed.
+ *
+ * 2. Table Step: for sine and cosine n = round(t/11.25), r = t - 11.25·n,
+ *    |r| ≤ 5.625, again exact, and 8·q + n indexes the π/16 table
+ *
+ * 3. Radians: θ = r·π/180 (t·π/180 for tangent) as a double-word,
+ *    data::kPiDiv180 being split in hi and lo
+ *
+ * 4. Reconstruction: KPi16Reconstruct<> as High<> does, or TanReduced<>
+ *
+ * Multiples of 90° hit the table entries, multiples of 30° and 45° are set
+ * to ±1/2 and ±1 where the rounded result might miss them, so all of them
+ * are exact. With kSpecialCases the signs of zeros and the poles of tangent
+ * follow TrigPi<>.
+ */
+template <Operation OP, typename Prec, typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V DegreeKernel(V a) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const V magic = Set(d, 0x1.8p52);
+  const V zero = Zero(d);
+
+  if constexpr (Prec::kLargeArgument) {
+    const auto is_huge = And(Ge(a, Set(d, kDegreeFoldBound)), IsFinite(a));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, is_huge))) {
+      a = IfThenElse(is_huge, FoldDegrees(a), a);
+    }
+  }
+  const V y = ReduceMod360(a);
+  const V q = Round(Mul(y, Set(d, 1.0 / 90)));
+  const V t = NegMulAdd(q, Set(d, 90.0), y);
+  const V t_abs = Abs(t);
+
+  constexpr auto kPiDiv180 = data::kPiDiv180<double>;
+  auto radians = [&](V deg, V &lo) {
+    V p_lo;
+    V p_hi = TwoProd(deg, Set(d, kPiDiv180[0]), p_lo);
+    lo = MulAdd(deg, Set(d, kPiDiv180[1]), p_lo);
+    return p_hi;
+  };
+
+  V ret;
+  if constexpr (OP == Operation::kTan) {
+    V theta_lo;
+    V theta = radians(t, theta_lo);
+    const auto quadrant = And(BitCast(di, Add(q, magic)), Set(di, 3));
+    ret = TanReduced<OP, true>(quadrant, theta, theta_lo);
+    // tan(±45°) = ±1
+    ret = IfThenElse(Eq(t_abs, Set(d, 45.0)), CopySign(Set(d, 1.0), ret),
+                     ret);
+  } else {
+    const V n = Round(Mul(t, Set(d, 4.0 / 45)));
+    const V r = NegMulAdd(n, Set(d, 11.25), t);
+    V theta_lo;
+    V theta = radians(r, theta_lo);
+    V n_biased = Add(MulAdd(q, Set(d, 8.0), n), magic);
+    V lo;  // only the rounded result is needed
+    ret = KPi16Reconstruct<OP>(n_biased, theta, theta_lo, lo);
+    // ±30° and ±60° off a multiple of 90° give ±1/2 or ±√3/2
+    const auto is_sixth =
+        Or(Eq(t_abs, Set(d, 30.0)), Eq(t_abs, Set(d, 60.0)));
+    const V half = Set(d, 0.5);
+    ret = IfThenElse(And(is_sixth, Lt(Abs(ret), Set(d, 0.75))),
+                     CopySign(half, ret), ret);
+  }
+
+  if constexpr (Prec::kSpecialCases) {
+    if constexpr (OP == Operation::kTan) {
+      // tan of an odd multiple of 180° is -0, and ±∞ at the poles
+      const V y_abs = Abs(y);
+      ret = IfThenElse(Eq(ret, zero),
+                       IfThenElse(Eq(y_abs, Set(d, 180.0)), Neg(zero), zero),
+                       ret);
+      ret = IfThenElse(Eq(y_abs, Set(d, 90.0)), CopySign(Inf(d), y), ret);
+    } else {
+      ret = IfThenElse(Eq(ret, zero), zero, ret);
+    }
+  }
+  return ret;
+}
+
+/// Float widens to the double kernel, see PiKernel<>.
+template <Operation OP, typename Prec, typename V, HWY_IF_F32(TFromV<V>)>
+NPSR_INTRIN V DegreeKernel(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  const Half<decltype(d)> dh;
+  const RepartitionToWide<decltype(d)> dw;
+  auto lo = DemoteTo(dh, DegreeKernel<OP, Prec>(PromoteLowerTo(dw, a)));
+  auto up = DemoteTo(dh, DegreeKernel<OP, Prec>(PromoteUpperTo(dw, a)));
+  return Combine(d, up, lo);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_DEGREE_INL_H_
@@ -6,14 +6,26 @@
 #endif
 
 #include "npsr/hwy.h"
+#include "npsr/poly-inl.h"
 #include "npsr/trig/data/data.h"
 #include "npsr/trig/low-inl.h"  // Operation
 
 HWY_BEFORE_NAMESPACE();
 namespace npsr::HWY_NAMESPACE::trig {
 
-template <Operation OP, class V>
-NPSR_INTRIN V Extended(V x) {
+/**
+ * Payne-Hanek reduction shared by Extended<> and ReducePiDiv2.
+ *
+ * Reduces x to x = k·(2π/2^kBits) + r, with kBits = 8 for float and 9 for
+ * double, and returns:
+ * - quotient: k in the low bits of each lane, as laid out by the magic
+ *   number conversion; the low kBits index the approx tables
+ * - r, r_lo: the remainder as an unevaluated sum, |r| ≤ π/2^kBits
+ *
+ * |x| < 2^-20 is passed through as r = x, r_lo = 0.
+ */
+template <class V, class VU>
+NPSR_INTRIN void ExtendedReduce(V x, VU &quotient, V &r, V &r_lo) {
   using namespace hn;
   namespace data = ::npsr::trig::data;
   using hwy::ExponentBits;
@@ -25,7 +37,6 @@ NPSR_INTRIN V Extended(V x) {
   using DI = RebindToSigned<D>;
   using DU = RebindToUnsigned<D>;
   using VI = Vec<DI>;
-  using VU = Vec<DU>;
   using T = TFromV<V>;
   using TU = TFromV<VU>;
   const D d;
@@ -217,8 +228,8 @@ NPSR_INTRIN V Extended(V x) {
   const V pi2_hi = Set(d, kPiMul2[0]);
   const V pi2_med = Set(d, kPiMul2[1]);
 
-  V r = Mul(pi2_hi, n);
-  V r_lo, r_w0, r_w1;
+  r = Mul(pi2_hi, n);
+  V r_w0, r_w1;
   if constexpr (!kNativeFMA && kIsSingle) {
     using DW = RepartitionToWide<D>;
     using DH = Half<D>;
@@ -248,6 +259,30 @@ NPSR_INTRIN V Extended(V x) {
 
   r = IfThenElse(ismall_arg, x, r);
   r_lo = IfThenElse(ismall_arg, Zero(d), r_lo);
+  quotient = BitCast(du, integer_part);
+}
+
+template <Operation OP, class V>
+NPSR_INTRIN V Extended(V x) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+
+  using D = DFromV<V>;
+  using DI = RebindToSigned<D>;
+  using DU = RebindToUnsigned<D>;
+  using VI = Vec<DI>;
+  using VU = Vec<DU>;
+  using T = TFromV<V>;
+  const D d;
+  const DI di;
+  const DU du;
+
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  // PHASES 1-8: Payne-Hanek reduction
+  VU quotient;
+  V r, r_lo;
+  ExtendedReduce(x, quotient, r, r_lo);
   V r2 = Mul(r, r);
 
   // =============================================================================
@@ -260,7 +295,7 @@ NPSR_INTRIN V Extended(V x) {
 
   // Calculate table index
   VU u_n_mask = Set(du, kIsSingle ? 0xFF : 0x1FF);
-  VU u_index = And(BitCast(du, integer_part), u_n_mask);
+  VU u_index = And(quotient, u_n_mask);
   VI u_table_index = BitCast(di, ShiftLeft<2>(u_index));
 
   const V deriv_hi = GatherIndex(d, table_base, u_table_index);
@@ -283,22 +318,17 @@ NPSR_INTRIN V Extended(V x) {
   res_lo = Add(res_lo, deriv_hi_r_cor);
 
   // Polynomial corrections
-  V s2 = Set(d, kIsSingle ? 0x1.1110b8p-7f : 0x1.1110fabb3551cp-7);
-  V s1 = Set(d, kIsSingle ? -0x1.555556p-3f : -0x1.5555555554448p-3);
-  V sin_poly = MulAdd(s2, r2, s1);
-  sin_poly = Mul(sin_poly, r);
-  sin_poly = Mul(sin_poly, r2);
-
-  V c1 = Set(d, kIsSingle ? 0x1.5554f8p-5f : 0x1.5555555554ccfp-5);
-  const V neg_half = Set(d, static_cast<T>(-0.5));
-  V cos_poly;
+  // sin(r) - r ≈ r³·(s1 + s2·r²), cos(r) - 1 ≈ r²·(-1/2 + c1·r² [+ c2·r⁴])
+  V sin_poly, cos_poly;
   if constexpr (kIsSingle) {
-    cos_poly = MulAdd(c1, r2, neg_half);
+    sin_poly = Poly(r2, {0x1.1110b8p-7f, -0x1.555556p-3f});
+    cos_poly = Poly(r2, {0x1.5554f8p-5f, -0.5f});
   } else {
-    V c2 = Set(d, -0x1.6c16ab163b2d7p-10);
-    cos_poly = MulAdd(c2, r2, c1);
-    cos_poly = MulAdd(cos_poly, r2, neg_half);
+    sin_poly = Poly(r2, {0x1.1110fabb3551cp-7, -0x1.5555555554448p-3});
+    cos_poly = Poly(r2, {-0x1.6c16ab163b2d7p-10, 0x1.5555555554ccfp-5, -0.5});
   }
+  sin_poly = Mul(sin_poly, r);
+  sin_poly = Mul(sin_poly, r2);
   cos_poly = Mul(cos_poly, r2);
 
   res_lo = MulAdd(sin_poly, deriv, res_lo);
@@ -7,118 +7,132 @@
 
 #include "npsr/hwy.h"
 #include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
 #include "npsr/trig/data/data.h"
 #include "npsr/trig/low-inl.h"  // Operation
+#include "npsr/trig/staged-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 
 namespace npsr::HWY_NAMESPACE::trig {
 
-template <Operation OP, typename V, HWY_IF_F32(TFromV<V>)>
-NPSR_INTRIN V High(V x) {
-  using namespace hn;
-  namespace data = ::npsr::trig::data;
-
-  using T = TFromV<V>;
-  using D = DFromV<V>;
-  using DU = RebindToUnsigned<D>;
-  using DH = Half<D>;
-  using DW = RepartitionToWide<D>;
-  using VW = Vec<DW>;
+template <Operation OP, typename T>
+struct HighStages;
 
-  const D d;
-  const DU du;
-  const DH dh;
-  const DW dw;
-  // Load frequently used constants as vector registers
-  const V abs_mask = BitCast(d, Set(du, 0x7FFFFFFF));
-  const V x_abs = And(abs_mask, x);
-  const V x_sign = AndNot(x_abs, x);
-
-  // Transform cosine to sine using identity: cos(x) = sin(x + π/2)
-  const V half_pi = Set(d, data::kHalfPi<T>);
-  V x_trans = x_abs;
-  if constexpr (OP == Operation::kCos) {
-    x_trans = Add(x_abs, half_pi);
+/**
+ * Stages of High<> for float, see Staged<>: n = round(x/π) is taken in
+ * float, the remainder and sin(r) ≈ r + r³·P(r²) in double over the lower
+ * and upper halves, r0/a0 and r1/a1 being r and r² of each half.
+ */
+template <Operation OP>
+struct HighStages<OP, float> {
+  static constexpr size_t kChains = 2;
+  template <class D>
+  using PolyTag = hn::RepartitionToWide<D>;
+
+  // Polynomial coefficients for sin(r) approximation on [-π/2, π/2]
+  static constexpr double kCoeffs[] = {
+      0x1.5dbdf0e4c7deep-19, -0x1.9f6ffeea73463p-13, 0x1.110ed3804ca96p-7,
+      -0x1.55554bc836587p-3};
+  static constexpr const auto &Coeffs0() { return kCoeffs; }
+  static constexpr const auto &Coeffs1() { return kCoeffs; }
+
+  template <typename V, typename VW>
+  NPSR_INTRIN void Reduce(V x, V &n_biased, VW &r_lo, VW &r_up, VW &r2_lo,
+                          VW &r2_up) {
+    using namespace hn;
+    namespace data = ::npsr::trig::data;
+    const DFromV<V> d;
+    const RebindToUnsigned<decltype(d)> du;
+    const DFromV<VW> dw;
+    // Load frequently used constants as vector registers
+    const V abs_mask = BitCast(d, Set(du, 0x7FFFFFFF));
+    const V x_abs = And(abs_mask, x);
+
+    // Transform cosine to sine using identity: cos(x) = sin(x + π/2)
+    V x_trans = x_abs;
+    if constexpr (OP == Operation::kCos) {
+      x_trans = Add(x_abs, Set(d, data::kHalfPi<float>));
+    }
+
+    // Compute N = round(input/π)
+    const V magic_round = Set(d, 0x1.8p23f);
+    n_biased = MulAdd(x_trans, Set(d, data::kInvPi<float>), magic_round);
+    V n = Sub(n_biased, magic_round);
+
+    // Adjust quotient for cosine (accounts for π/2 phase shift)
+    if constexpr (OP == Operation::kCos) {
+      // For cosine, we computed N = round((x + π/2)/π) but need N' for x:
+      //   N = round((x + π/2)/π) = round(x/π + 0.5)
+      // This is often 1 more than round(x/π), so we subtract 0.5:
+      //   N' = N - 0.5
+      n = Sub(n, Set(d, 0.5f));
+    }
+    auto WideReduce = [&dw](const VW &nh, const VW &xh_abs, VW &r,
+                            VW &r2) {
+      constexpr auto kPiPrec35 = data::kPiPrec35<true>;
+      r = NegMulAdd(nh, Set(dw, kPiPrec35[0]), xh_abs);
+      r = NegMulAdd(nh, Set(dw, kPiPrec35[1]), r);
+      r2 = Mul(r, r);
+    };
+    WideReduce(PromoteLowerTo(dw, n), PromoteLowerTo(dw, x_abs), r_lo, r2_lo);
+    WideReduce(PromoteUpperTo(dw, n), PromoteUpperTo(dw, x_abs), r_up, r2_up);
   }
-  // check zero input/subnormal for cosine (cos(~0) = 1)
-  const auto is_cos_near_zero = Eq(x_trans, half_pi);
 
-  // Compute N = round(input/π)
-  const V magic_round = Set(d, 0x1.8p23f);
-  V n_biased = MulAdd(x_trans, Set(d, data::kInvPi<T>), magic_round);
-  V n = Sub(n_biased, magic_round);
-
-  // Adjust quotient for cosine (accounts for π/2 phase shift)
-  if constexpr (OP == Operation::kCos) {
-    // For cosine, we computed N = round((x + π/2)/π) but need N' for x:
-    //   N = round((x + π/2)/π) = round(x/π + 0.5)
-    // This is often 1 more than round(x/π), so we subtract 0.5:
-    //   N' = N - 0.5
-    n = Sub(n, Set(d, 0.5f));
-  }
-  auto WideCal = [](const VW &nh, const VW &xh_abs) -> VW {
-    const DFromV<VW> dw;
-    constexpr auto kPiPrec35 = data::kPiPrec35<true>;
-    VW r = NegMulAdd(nh, Set(dw, kPiPrec35[0]), xh_abs);
-    r = NegMulAdd(nh, Set(dw, kPiPrec35[1]), r);
-    VW r2 = Mul(r, r);
-
-    // Polynomial coefficients for sin(r) approximation on [-π/2, π/2]
-    const VW c9 = Set(dw, 0x1.5dbdf0e4c7deep-19);
-    const VW c7 = Set(dw, -0x1.9f6ffeea73463p-13);
-    const VW c5 = Set(dw, 0x1.110ed3804ca96p-7);
-    const VW c3 = Set(dw, -0x1.55554bc836587p-3);
-    VW poly = MulAdd(c9, r2, c7);
-    poly = MulAdd(r2, poly, c5);
-    poly = MulAdd(r2, poly, c3);
-    poly = Mul(poly, r2);
-    poly = MulAdd(r, poly, r);
+  template <typename V, typename VW>
+  NPSR_INTRIN V Finish(V x, V n_biased, VW r_lo, VW r_up, VW r2_lo, VW r2_up,
+                       VW poly_lo, VW poly_up) {
+    using namespace hn;
+    namespace data = ::npsr::trig::data;
+    const DFromV<V> d;
+    const RebindToUnsigned<decltype(d)> du;
+    const Half<decltype(d)> dh;
+    const V abs_mask = BitCast(d, Set(du, 0x7FFFFFFF));
+    const V x_abs = And(abs_mask, x);
+    const V x_sign = AndNot(x_abs, x);
+
+    poly_lo = MulAdd(r_lo, Mul(poly_lo, r2_lo), r_lo);
+    poly_up = MulAdd(r_up, Mul(poly_up, r2_up), r_up);
+
+    V poly = Combine(d, DemoteTo(dh, poly_up), DemoteTo(dh, poly_lo));
+    // Extract octant sign information from quotient and flip the sign bit
+    poly = Xor(poly, BitCast(d, ShiftLeft<31>(BitCast(du, n_biased))));
+    if constexpr (OP == Operation::kCos) {
+      // check zero input/subnormal for cosine (cos(~0) = 1)
+      const V half_pi = Set(d, data::kHalfPi<float>);
+      const auto is_cos_near_zero = Eq(Add(x_abs, half_pi), half_pi);
+      poly = IfThenElse(is_cos_near_zero, Set(d, 1.0f), poly);
+    } else {
+      // Restore original sign for sine (odd function)
+      poly = Xor(poly, x_sign);
+    }
     return poly;
-  };
-
-  VW poly_lo = WideCal(PromoteLowerTo(dw, n), PromoteLowerTo(dw, x_abs));
-  VW poly_up = WideCal(PromoteUpperTo(dw, n), PromoteUpperTo(dw, x_abs));
-
-  V poly = Combine(d, DemoteTo(dh, poly_up), DemoteTo(dh, poly_lo));
-  // Extract octant sign information from quotient and flip the sign bit
-  poly = Xor(poly,
-             BitCast(d, ShiftLeft<sizeof(T) * 8 - 1>(BitCast(du, n_biased))));
-  if constexpr (OP == Operation::kCos) {
-    poly = IfThenElse(is_cos_near_zero, Set(d, 1.0f), poly);
-  } else {
-    // Restore original sign for sine (odd function)
-    poly = Xor(poly, x_sign);
   }
-  return poly;
-}
+};
+
+// Step 4 of High<> for double, polynomial approximation in r².
+// Minimax polynomial for (sin(r)/r - 1)
+// sin(r)/r = 1 - r²/3! + r⁴/5! - r⁶/7! + ...
+// This polynomial computes the terms after 1
+constexpr double kKPi16SinPoly[] = {
+    0x1.71c97d22a73ddp-19, -0x1.a01a00ed01edep-13, 0x1.111111110e99dp-7,
+    -0x1.5555555555555p-3};
+// Minimax polynomial for (cos(r) - 1)/r²
+// cos(r) = 1 - r²/2! + r⁴/4! - r⁶/6! + ...
+// This polynomial computes (cos(r) - 1)/r²
+constexpr double kKPi16CosPoly[] = {
+    0x1.9ffd7d9d749bcp-16, -0x1.6c16c075d73f8p-10, 0x1.555555554e8d6p-5,
+    -0x1.ffffffffffffcp-2};
+
 /**
- * This function computes sin(x) or cos(x) for |x| < 2^24 using the Cody-Waite
- * reduction algorithm combined with table lookup and polynomial approximation,
- * achieves < 1 ULP error for |x| < 2^24.
- *
- * Algorithm Overview:
- * 1. Range Reduction: Reduces input x to r where |r| < π/16
- *    - Computes n = round(x * 16/π) and r = x - n*π/16
- *    - Uses multi-precision arithmetic (3 parts of π/16) for accuracy
- *
- * 2. Table Lookup: Retrieves precomputed sin(n*π/16) and cos(n*π/16)
- *    - Includes high and low precision parts for cos values
- *
- * 3. Polynomial Approximation: Computes sin(r) and cos(r)
- *    - sin(r) ≈ r * (1 + r²*P_sin(r²)) where P_sin is a minimax polynomial
- *    - cos(r) ≈ 1 + r²*P_cos(r²) where P_cos is a minimax polynomial
- *
- * 4. Reconstruction: Applies angle addition formulas
- *    - sin(x) = sin(n*π/16 + r) = sin(n*π/16)*cos(r) + cos(n*π/16)*sin(r)
- *    - cos(x) = cos(n*π/16 + r) = cos(n*π/16)*cos(r) - sin(n*π/16)*sin(r)
- *
+ * Steps 2 and 5 of High<> for double, KPi16Reconstruct<> once the
+ * polynomials of step 4 are known: r2 = r², sin_poly and cos_poly evaluated
+ * at r2 from kKPi16SinPoly and kKPi16CosPoly.
  */
 template <Operation OP, typename V, HWY_IF_F64(TFromV<V>)>
-NPSR_INTRIN V High(V x) {
+NPSR_INTRIN V KPi16Finish(V n_biased, V r, V r_lo, V r2, V sin_poly,
+                          V cos_poly, V &lo) {
   using namespace hn;
-  namespace data = ::npsr::trig::data;
-  using T = TFromV<V>;
   using D = DFromV<V>;
   using DU = RebindToUnsigned<D>;
   using VU = Vec<DU>;
@@ -126,12 +140,6 @@ NPSR_INTRIN V High(V x) {
   const D d;
   const DU du;
 
-  // Step 1: Range reduction - find n such that x = n*(π/16) + r, where |r| <
-  // π/16
-  V magic = Set(d, 0x1.8p52);
-  V n_biased = MulAdd(x, Set(d, data::k16DivPi<T>), magic);
-  V n = Sub(n_biased, magic);
-
   // Extract integer index for table lookup (n mod 16)
   VU n_int = BitCast(du, n_biased);
   VU table_idx = And(n_int, Set(du, 0xF));  // Mask to get n mod 16
@@ -145,43 +153,6 @@ NPSR_INTRIN V High(V x) {
   // see data/lut-inl.h.sol for the table generation code.
   V sin_lo = BitCast(d, ShiftLeft<32>(BitCast(du, cos_lo)));
 
-  // Step 3: Multi-precision computation of remainder r
-  // r = x - n*(π/16)_high
-  constexpr auto kPiDiv16Prec29 = data::kPiDiv16Prec29<kNativeFMA>;
-  V r_hi = NegMulAdd(n, Set(d, kPiDiv16Prec29[0]), x);
-  if constexpr (!kNativeFMA) {
-    // For F64, we need to handle the low precision part separately
-    r_hi = NegMulAdd(n, Set(d, kPiDiv16Prec29[3]), r_hi);
-  }
-  const V pi16_med = Set(d, kPiDiv16Prec29[1]);
-  const V pi16_lo = Set(d, kPiDiv16Prec29[2]);
-  V r_med = NegMulAdd(n, pi16_med, r_hi);
-  V r = NegMulAdd(n, pi16_lo, r_med);
-
-  // Compute low precision part of r for extra accuracy
-  V term = NegMulAdd(pi16_med, n, Sub(r_hi, r_med));
-  V r_lo = MulAdd(pi16_lo, n, Sub(r, r_med));
-  r_lo = Sub(term, r_lo);
-
-  // Step 4: Polynomial approximation
-  V r2 = Mul(r, r);
-
-  // Minimax polynomial for (sin(r)/r - 1)
-  // sin(r)/r = 1 - r²/3! + r⁴/5! - r⁶/7! + ...
-  // This polynomial computes the terms after 1
-  V sin_poly = Set(d, 0x1.71c97d22a73ddp-19);
-  sin_poly = MulAdd(sin_poly, r2, Set(d, -0x1.a01a00ed01edep-13));
-  sin_poly = MulAdd(sin_poly, r2, Set(d, 0x1.111111110e99dp-7));
-  sin_poly = MulAdd(sin_poly, r2, Set(d, -0x1.5555555555555p-3));
-
-  // Minimax polynomial for (cos(r) - 1)/r²
-  // cos(r) = 1 - r²/2! + r⁴/4! - r⁶/6! + ...
-  // This polynomial computes (cos(r) - 1)/r²
-  V cos_poly = Set(d, 0x1.9ffd7d9d749bcp-16);
-  cos_poly = MulAdd(cos_poly, r2, Set(d, -0x1.6c16c075d73f8p-10));
-  cos_poly = MulAdd(cos_poly, r2, Set(d, 0x1.555555554e8d6p-5));
-  cos_poly = MulAdd(cos_poly, r2, Set(d, -0x1.ffffffffffffcp-2));
-
   // Step 5: Reconstruction using angle addition formulas
   //
   // Mathematical equivalence between traditional and SVML approaches:
@@ -239,8 +210,9 @@ NPSR_INTRIN V High(V x) {
     V total_low = Sub(low_corr, sin_low_corr);
 
     // Final assembly: main_term + r²*polynomial_corrections + low_corrections
-    result = MulAdd(r2, poly_corr, total_low);
-    result = Add(res_hi, result);
+    V corr = MulAdd(r2, poly_corr, total_low);
+    result = Add(res_hi, corr);
+    lo = Sub(corr, Sub(result, res_hi));
 
   } else {
     // Sine reconstruction: sin_table + cos_table*remainder
@@ -273,24 +245,125 @@ NPSR_INTRIN V High(V x) {
     // Combine all low precision corrections
     V total_low = Add(low_corr, cos_low_corr);
     // Final assembly: main_term + r²*polynomial_corrections + low_corrections
-    result = MulAdd(r2, poly_corr, total_low);
-    result = Add(res_hi, result);
+    V corr = MulAdd(r2, poly_corr, total_low);
+    result = Add(res_hi, corr);
+    lo = Sub(corr, Sub(result, res_hi));
   }
 
   // Apply final sign correction same for both sine and cosine
-  // Both functions change sign every π radians, corresponding to bit 4 of n_int
-  // This unified approach works because:
+  // Both functions change sign every π radians, corresponding to bit 4 of n
   // - sin(x + π) = -sin(x)
   // - cos(x + π) = -cos(x)
-  VU x_sign_int = ShiftLeft<63>(BitCast(du, x));
-  // XOR with quadrant info in n_biased
-  VU combined = Xor(BitCast(du, n_biased), ShiftLeft<4>(x_sign_int));
-  // Extract final sign
-  VU sign = ShiftRight<4>(combined);
-  sign = ShiftLeft<63>(sign);
+  VU sign = ShiftLeft<63>(ShiftRight<4>(n_int));
   result = Xor(result, BitCast(d, sign));  // Apply sign flip
+  lo = Xor(lo, BitCast(d, sign));
   return result;
 }
+
+/**
+ * Steps 2 to 5 of High<> for double: table lookup, polynomial and angle
+ * addition for x = n·π/16 + r + r_lo, |r| ≤ π/32, where the low bits of
+ * n_biased hold n, sign bit included. Shared with the π-scaled kernels of
+ * pi-inl.h, whose reduction is exact.
+ *
+ * The final sum is split by a fast two-sum, lo being its rounding error, for
+ * callers that keep working on the result.
+ */
+template <Operation OP, typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V KPi16Reconstruct(V n_biased, V r, V r_lo, V &lo) {
+  using namespace hn;
+  V r2 = Mul(r, r);
+  V sin_poly = Poly(r2, kKPi16SinPoly);
+  V cos_poly = Poly(r2, kKPi16CosPoly);
+  return KPi16Finish<OP>(n_biased, r, r_lo, r2, sin_poly, cos_poly, lo);
+}
+
+/**
+ * Stages of High<> for double, see Staged<>: s = n biased, r0 + r1 the
+ * remainder, a0 = a1 = r0².
+ *
+ * This kernel computes sin(x) or cos(x) for |x| < 2^24 using the Cody-Waite
+ * reduction algorithm combined with table lookup and polynomial approximation,
+ * achieves < 1 ULP error for |x| < 2^24.
+ *
+ * Algorithm Overview:
+ * 1. Range Reduction: Reduces input x to r where |r| < π/16
+ *    - Computes n = round(x * 16/π) and r = x - n*π/16
+ *    - Uses multi-precision arithmetic (3 parts of π/16) for accuracy
+ *
+ * 2. Table Lookup: Retrieves precomputed sin(n*π/16) and cos(n*π/16)
+ *    - Includes high and low precision parts for cos values
+ *
+ * 3. Polynomial Approximation: Computes sin(r) and cos(r)
+ *    - sin(r) ≈ r * (1 + r²*P_sin(r²)) where P_sin is a minimax polynomial
+ *    - cos(r) ≈ 1 + r²*P_cos(r²) where P_cos is a minimax polynomial
+ *
+ * 4. Reconstruction: Applies angle addition formulas
+ *    - sin(x) = sin(n*π/16 + r) = sin(n*π/16)*cos(r) + cos(n*π/16)*sin(r)
+ *    - cos(x) = cos(n*π/16 + r) = cos(n*π/16)*cos(r) - sin(n*π/16)*sin(r)
+ *
+ */
+template <Operation OP>
+struct HighStages<OP, double> {
+  static constexpr size_t kChains = 2;
+  template <class D>
+  using PolyTag = D;
+
+  static constexpr const auto &Coeffs0() { return kKPi16SinPoly; }
+  static constexpr const auto &Coeffs1() { return kKPi16CosPoly; }
+
+  template <typename V>
+  NPSR_INTRIN void Reduce(V x, V &n_biased, V &r, V &r_lo, V &r2, V &a1) {
+    using namespace hn;
+    namespace data = ::npsr::trig::data;
+    const DFromV<V> d;
+
+    // Step 1: Range reduction - find n such that x = n*(π/16) + r, where
+    // |r| < π/16
+    V magic = Set(d, 0x1.8p52);
+    n_biased = MulAdd(x, Set(d, data::k16DivPi<double>), magic);
+    V n = Sub(n_biased, magic);
+
+    // Step 3: Multi-precision computation of remainder r
+    // r = x - n*(π/16)_high
+    constexpr auto kPiDiv16Prec29 = data::kPiDiv16Prec29<kNativeFMA>;
+    V r_hi = NegMulAdd(n, Set(d, kPiDiv16Prec29[0]), x);
+    if constexpr (!kNativeFMA) {
+      // For F64, we need to handle the low precision part separately
+      r_hi = NegMulAdd(n, Set(d, kPiDiv16Prec29[3]), r_hi);
+    }
+    const V pi16_med = Set(d, kPiDiv16Prec29[1]);
+    const V pi16_lo = Set(d, kPiDiv16Prec29[2]);
+    V r_med = NegMulAdd(n, pi16_med, r_hi);
+    r = NegMulAdd(n, pi16_lo, r_med);
+
+    // Compute low precision part of r for extra accuracy
+    V term = NegMulAdd(pi16_med, n, Sub(r_hi, r_med));
+    r_lo = MulAdd(pi16_lo, n, Sub(r, r_med));
+    r_lo = Sub(term, r_lo);
+
+    // Step 4 runs on r², see Staged<>
+    r2 = Mul(r, r);
+    a1 = r2;
+  }
+
+  template <typename V>
+  NPSR_INTRIN V Finish(V, V n_biased, V r, V r_lo, V r2, V, V sin_poly,
+                       V cos_poly) {
+    V lo;  // only the rounded result is needed
+    return KPi16Finish<OP>(n_biased, r, r_lo, r2, sin_poly, cos_poly, lo);
+  }
+};
+
+/**
+ * This function computes sin(x) or cos(x). Float takes the Cody-Waite
+ * reduction by π in float and evaluates the remainder and polynomial in
+ * double, see HighStages<OP, float>; double is described below.
+ */
+template <Operation OP, typename V>
+NPSR_INTRIN V High(V x) {
+  return Staged<HighStages<OP, hn::TFromV<V>>>(x);
+}
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace npsr::HWY_NAMESPACE::trig
 
@@ -1,11 +1,15 @@
 // Main trigonometric function dispatcher for Highway SIMD library
-// This file provides the public API for sine and cosine functions with
-// configurable precision, special case handling, and algorithm selection
+// This file provides the public API for sine, cosine, tangent and cotangent
+// functions with configurable precision, special case handling, and
+// algorithm selection
 //
 // The implementation automatically selects between three algorithms:
 // 1. Low precision: ~1-4 ULP error, fastest
 // 2. High precision: ~1 ULP error, moderate speed
 // 3. Extended precision: Exact for |x| > 2^24 (float) or 2^53 (double)
+//
+// SinPi, CosPi, TanPi and Sinc reduce exactly and reuse the High kernels,
+// and so do SinD, CosD and TanD for degrees.
 
 #if defined(NPSR_TRIG_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
 #ifdef NPSR_TRIG_INL_H_
@@ -14,35 +18,176 @@
 #define NPSR_TRIG_INL_H_
 #endif
 
+#include <type_traits>
+
 #include "npsr/hwy.h"
 #include "npsr/precise.h"
+#include "npsr/trig/degree-inl.h"    // Degree kernels, exact reduction
 #include "npsr/trig/extended-inl.h"  // Payne-Hanek reduction for huge arguments
 #include "npsr/trig/high-inl.h"      // High precision with table lookup
 #include "npsr/trig/low-inl.h"       // Fast low precision implementation
+#include "npsr/trig/pi-inl.h"        // π-scaled kernels, exact reduction
+#include "npsr/trig/plan-inl.h"      // Reduce once, evaluate many times
+#include "npsr/trig/reduce-inl.h"    // Public x mod π/2 and angle wrapping
+#include "npsr/trig/small-inl.h"     // Reduction-free path for |x| ≤ π/4
+#include "npsr/trig/staged-inl.h"    // Interleaving of several vectors
+#include "npsr/trig/tan-inl.h"       // Tangent and cotangent kernels
 
 HWY_BEFORE_NAMESPACE();
 
 namespace npsr::HWY_NAMESPACE::trig {
+
+// Step 1: Select base algorithm based on accuracy requirements. Each one is
+// a set of stages, see Staged<>, so that several vectors can be interleaved.
+//
+// - Tangent and cotangent: same reduction tiers, then the π/16 tangent
+//   table and one division, TanLow<> or TanHigh<>
+// - Low precision: Cody-Waite reduction with degree-9 polynomial, Low<>.
+//   Error: ~2 ULP and 3~ for non-fma. kMaxULP<N> lowers the polynomial
+//   degree while staying within N ULP
+// - High precision: π/16 reduction with table lookup + polynomial, High<>.
+//   Error: ~1 ULP
+template <Operation OP, typename Prec, typename T>
+using TrigStages = std::conditional_t<
+    OP == Operation::kTan || OP == Operation::kCot,
+    TanStages<OP, !Prec::kLowAccuracy, T>,
+    std::conditional_t<Prec::kLowAccuracy,
+                       LowStages<OP, LowDegree<T>(Prec::kMaxULPBudget), T>,
+                       HighStages<OP, T>>>;
+
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V TrigKernel(V x) {
+  return Staged<TrigStages<OP, Prec, hn::TFromV<V>>>(x);
+}
+
+// Step 2: Handle special cases (NaN, Inf) if enabled
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V TrigSpecialCases(V x, V ret) {
+  using namespace hn;
+  const DFromV<V> d;
+  if constexpr (Prec::kSpecialCases) {
+    // IEEE 754 requires: sin(±∞) = NaN, cos(±∞) = NaN
+    ret = IfThenElse(IsFinite(x), ret, NaN(d));
+    // -0.0 should return -0.0 for sine and tangent
+    if constexpr (OP == Operation::kSin || OP == Operation::kTan) {
+      ret = IfThenElse(Eq(x, Set(d, 0.0)), x, ret);
+    }
+    // cot(±0) = ±∞
+    if constexpr (OP == Operation::kCot) {
+      ret = IfThenElse(Eq(x, Set(d, 0.0)), CopySign(Inf(d), x), ret);
+    }
+  }
+  return ret;
+}
+
+// Kernels of the large and small argument paths for each operation.
+// LargeArgument::kNeverExtended reduces with LongCodyWaitePiDiv2, a longer
+// Cody-Waite without table lookups, and evaluates the quadrants as
+// reduction plans do: both Small<> polynomials and a quadrant select, or an
+// uncompensated TanReduced<>. Valid for |x| < 2^46 only.
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V LargeKernel(V x) {
+  using namespace hn;
+  constexpr bool kIsTan = OP == Operation::kTan || OP == Operation::kCot;
+  if constexpr (Prec::kNeverExtended) {
+    Vec<RebindToSigned<DFromV<V>>> quadrant;
+    V r_hi, r_lo;
+    LongCodyWaitePiDiv2(x, quadrant, r_hi, r_lo);
+    if constexpr (kIsTan) {
+      return TanReduced<OP, false>(quadrant, r_hi, r_lo);
+    } else {
+      V sin_v, cos_v;
+      PlanSinCos<OP == Operation::kSin, OP == Operation::kCos, Prec>(
+          quadrant, r_hi, r_lo, sin_v, cos_v);
+      if constexpr (OP == Operation::kSin) {
+        return sin_v;
+      } else {
+        return cos_v;
+      }
+    }
+  } else if constexpr (kIsTan) {
+    return TanExtended<OP>(x);
+  } else {
+    return Extended<OP>(x);
+  }
+}
+
+template <Operation OP, typename V>
+NPSR_INTRIN V SmallKernel(V x) {
+  if constexpr (OP == Operation::kTan || OP == Operation::kCot) {
+    return TanSmall<OP>(x);
+  } else {
+    return Small<OP>(x);
+  }
+}
+
+// Step 3: Lanes whose magnitude requires the extended precision reduction.
+// Thresholds chosen based on when standard reduction loses accuracy:
+// - Float: 10,000 is conservative but ensures < 1 ULP error
+// - Double: 2^24 is where mantissa can't represent x and x-2π distinctly
+template <typename V>
+NPSR_INTRIN auto LargeArgMask(V x) {
+  using namespace hn;
+  constexpr bool kIsSingle = std::is_same_v<TFromV<V>, float>;
+  const DFromV<V> d;
+  return And(Gt(Abs(x), Set(d, kIsSingle ? 10000.0f : 16777216.0)),
+             IsFinite(x));
+}
+
+// Step 4: Exceptions raised by the input, invalid for infinities and
+// division by zero for the pole of cotangent at ±0
+template <Operation OP, typename V>
+NPSR_INTRIN int TrigExceptions(V x) {
+  using namespace hn;
+  const DFromV<V> d;
+  int flags = !AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0;
+  if constexpr (OP == Operation::kCot) {
+    flags |= !AllFalse(d, Eq(x, Zero(d))) ? FPExceptions::kDivByZero : 0;
+  }
+  return flags;
+}
+
 /**
- * @brief Unified sine/cosine implementation with configurable precision
+ * @brief Unified trigonometric implementation with configurable precision
  *
  * This template function dispatches to the appropriate algorithm based on:
  * - Precision requirements (Low vs High accuracy)
  * - Input magnitude (standard vs extended precision for large arguments)
  * - Special case handling (NaN, Inf)
  *
- * @tparam OP       Operation type: kSin or kCos
+ * @tparam OP       Operation type: kSin, kCos, kTan or kCot
  * @tparam Prec     Precise configuration class with accuracy/feature flags
  * @tparam V        Highway vector type
  *
  * @param prec      Precise object controlling FP environment and exceptions
  * @param x         Input vector
- * @return          sin(x) or cos(x) depending on OP
+ * @return          sin(x), cos(x), tan(x) or cot(x) depending on OP
  *
  * Algorithm selection:
- * 1. If kLowAccuracy: Use Low<> (Cody-Waite with minimal polynomial)
+ * 1. If kLowAccuracy or kMaxULP<N>: Use Low<> (Cody-Waite with minimal
+ *    polynomial, shortened further as the ULP budget allows)
  * 2. Otherwise: Use High<> (π/16 reduction with table lookup)
- * 3. If kLargeArgument and |x| > threshold: Override with Extended<>
+ * 3. If kLargeArgument and |x| > threshold: Override with Extended<>, or
+ *    the cheaper path of kNeverExtended
+ *
+ * kTan and kCot take the same steps with the kernels of tan-inl.h: TanLow<>
+ * or TanHigh<>, then TanExtended<> for large arguments.
+ *
+ * With kSmallArgument, a vector whose lanes all satisfy |x| ≤ π/4 skips all
+ * of the above and is evaluated by Small<>, a direct minimax polynomial.
+ * The check costs one compare and one branch per vector.
+ *
+ * Large argument policy (Precise LargeArgument::k*):
+ * - kBranchy: Extended<> runs only for vectors holding a large lane. Best
+ *   average cost, but the branch mispredicts when large lanes are random.
+ * - kBranchless: Extended<> always runs and is blended in. Slower on
+ *   average, constant cost per vector.
+ * - kNeverExtended: no branch either, but large lanes take a cheaper
+ *   fixed-cost path than Extended<>, a longer Cody-Waite without table
+ *   lookups, see LargeKernel<>. Valid for |x| < 2^46 only, where the
+ *   error stays below ~0.9 ULP for sine and cosine and ~3 ULP for tangent
+ *   and cotangent; beyond it the result is unspecified.
+ * kSmallArgument adds its own branch and is not affected by the policy.
  *
  * Thresholds for extended precision:
  * - Float: |x| > 10,000 (empirically chosen for accuracy)
@@ -50,54 +195,366 @@ namespace npsr::HWY_NAMESPACE::trig {
  */
 template <Operation OP, typename Prec, typename V>
 NPSR_INTRIN V Trig(Prec &prec, V x) {
-  using namespace hwy::HWY_NAMESPACE;
-  constexpr bool kIsSingle = std::is_same_v<TFromV<V>, float>;
+  using namespace hn;
   const DFromV<V> d;
-  V ret;
-  // Step 1: Select base algorithm based on accuracy requirements
-  if constexpr (Prec::kLowAccuracy) {
-    // Low precision: Cody-Waite reduction with degree-9 polynomial
-    // Error: ~2 ULP and 3~ for non-fma
-    ret = Low<OP>(x);
-  } else {
-    // High precision: π/16 reduction with table lookup + polynomial
-    // Error: ~1 ULP
-    ret = High<OP>(x);
-  }
-  // Step 2: Handle special cases (NaN, Inf) if enabled
-  auto is_finite = IsFinite(x);
-  if constexpr (Prec::kSpecialCases) {
-    // IEEE 754 requires: sin(±∞) = NaN, cos(±∞) = NaN
-    ret = IfThenElse(is_finite, ret, NaN(d));
-    // -0.0 should return -0.0 for sine
-    if constexpr (OP == Operation::kSin) {
-      ret = IfThenElse(Eq(x, Set(d, 0.0)), x, ret);
+  if constexpr (Prec::kSmallArgument) {
+    // Small lanes are finite, so only the sign of zero needs care and no
+    // exception can be raised, apart from the pole of cotangent
+    if (AllTrue(d, SmallArgMask(x))) {
+      if constexpr (Prec::kExceptions && OP == Operation::kCot) {
+        prec.Raise(TrigExceptions<OP>(x));
+      }
+      return TrigSpecialCases<OP, Prec>(x, SmallKernel<OP>(x));
     }
   }
-  // Step 3: Handle very large arguments if enabled
+  V ret = TrigKernel<OP, Prec>(x);
+  ret = TrigSpecialCases<OP, Prec>(x, ret);
   // For |x| > threshold, standard algorithms lose precision due to
   // catastrophic cancellation in x - n*π reduction
   if constexpr (Prec::kLargeArgument) {
-    // Thresholds chosen based on when standard reduction loses accuracy:
-    // - Float: 10,000 is conservative but ensures < 1 ULP error
-    // - Double: 2^24 is where mantissa can't represent x and x-2π distinctly
-    auto has_large_arg =
-        And(Gt(Abs(x), Set(d, kIsSingle ? 10000.0f : 16777216.0)), is_finite);
-
-    // Extended precision is expensive, only use when necessary
-    if (HWY_UNLIKELY(!AllFalse(d, has_large_arg))) {
+    auto has_large_arg = LargeArgMask(x);
+    // Extended precision is expensive, only use when necessary, unless the
+    // branch itself is unwanted (only kBranchy keeps the condition)
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, has_large_arg))) {
       // Payne-Hanek reduction: Uses ~96-bit (float) or ~192-bit (double)
       // precision for 4/π to maintain accuracy for huge arguments
-      ret = IfThenElse(has_large_arg, Extended<OP>(x), ret);
+      ret = IfThenElse(has_large_arg, LargeKernel<OP, Prec>(x), ret);
+    }
+  }
+  // Step 4: Raise invalid operation exception for infinity inputs, and
+  // division by zero for cot(±0)
+  if constexpr (Prec::kExceptions) {
+    prec.Raise(TrigExceptions<OP>(x));
+  }
+  return ret;
+}
+
+/**
+ * @brief Two-vector variant of Trig, interleaving both inputs stage by stage.
+ *
+ * A single call is one long dependent chain, reduction then polynomial then
+ * reconstruction, which leaves the second FMA port idle on wide cores.
+ * Here the base kernel runs through Staged<>: both reductions, then both
+ * polynomials with their Horner steps in lockstep, then both
+ * reconstructions. The large argument and exception checks are taken once
+ * for the pair.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN void Trig(Prec &prec, V x0, V x1, V &out0, V &out1) {
+  using namespace hn;
+  const DFromV<V> d;
+  if constexpr (Prec::kSmallArgument) {
+    if (AllTrue(d, And(SmallArgMask(x0), SmallArgMask(x1)))) {
+      if constexpr (Prec::kExceptions && OP == Operation::kCot) {
+        prec.Raise(TrigExceptions<OP>(x0) | TrigExceptions<OP>(x1));
+      }
+      out0 = TrigSpecialCases<OP, Prec>(x0, SmallKernel<OP>(x0));
+      out1 = TrigSpecialCases<OP, Prec>(x1, SmallKernel<OP>(x1));
+      return;
+    }
+  }
+  using Stages = TrigStages<OP, Prec, TFromV<V>>;
+  V ret0, ret1;
+  Staged<Stages>(x0, x1, ret0, ret1);
+  ret0 = TrigSpecialCases<OP, Prec>(x0, ret0);
+  ret1 = TrigSpecialCases<OP, Prec>(x1, ret1);
+  if constexpr (Prec::kLargeArgument) {
+    auto has_large_arg0 = LargeArgMask(x0);
+    auto has_large_arg1 = LargeArgMask(x1);
+    if (!Prec::kBranchy ||
+        HWY_UNLIKELY(!AllFalse(d, Or(has_large_arg0, has_large_arg1)))) {
+      ret0 = IfThenElse(has_large_arg0, LargeKernel<OP, Prec>(x0), ret0);
+      ret1 = IfThenElse(has_large_arg1, LargeKernel<OP, Prec>(x1), ret1);
     }
   }
-  // Step 4: Raise invalid operation exception for infinity inputs
   if constexpr (Prec::kExceptions) {
-    prec.Raise(!AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0);
+    prec.Raise(TrigExceptions<OP>(x0) | TrigExceptions<OP>(x1));
+  }
+  out0 = ret0;
+  out1 = ret1;
+}
+
+/// Four-vector variant of Trig, see the two-vector overload.
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN void Trig(Prec &prec, V x0, V x1, V x2, V x3, V &out0, V &out1,
+                      V &out2, V &out3) {
+  using namespace hn;
+  const DFromV<V> d;
+  if constexpr (Prec::kSmallArgument) {
+    auto is_small = And(And(SmallArgMask(x0), SmallArgMask(x1)),
+                        And(SmallArgMask(x2), SmallArgMask(x3)));
+    if (AllTrue(d, is_small)) {
+      if constexpr (Prec::kExceptions && OP == Operation::kCot) {
+        prec.Raise(TrigExceptions<OP>(x0) | TrigExceptions<OP>(x1) |
+                   TrigExceptions<OP>(x2) | TrigExceptions<OP>(x3));
+      }
+      out0 = TrigSpecialCases<OP, Prec>(x0, SmallKernel<OP>(x0));
+      out1 = TrigSpecialCases<OP, Prec>(x1, SmallKernel<OP>(x1));
+      out2 = TrigSpecialCases<OP, Prec>(x2, SmallKernel<OP>(x2));
+      out3 = TrigSpecialCases<OP, Prec>(x3, SmallKernel<OP>(x3));
+      return;
+    }
+  }
+  using Stages = TrigStages<OP, Prec, TFromV<V>>;
+  V ret0, ret1, ret2, ret3;
+  Staged<Stages>(x0, x1, x2, x3, ret0, ret1, ret2, ret3);
+  ret0 = TrigSpecialCases<OP, Prec>(x0, ret0);
+  ret1 = TrigSpecialCases<OP, Prec>(x1, ret1);
+  ret2 = TrigSpecialCases<OP, Prec>(x2, ret2);
+  ret3 = TrigSpecialCases<OP, Prec>(x3, ret3);
+  if constexpr (Prec::kLargeArgument) {
+    auto has_large_arg0 = LargeArgMask(x0);
+    auto has_large_arg1 = LargeArgMask(x1);
+    auto has_large_arg2 = LargeArgMask(x2);
+    auto has_large_arg3 = LargeArgMask(x3);
+    auto has_large_arg = Or(Or(has_large_arg0, has_large_arg1),
+                            Or(has_large_arg2, has_large_arg3));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, has_large_arg))) {
+      ret0 = IfThenElse(has_large_arg0, LargeKernel<OP, Prec>(x0), ret0);
+      ret1 = IfThenElse(has_large_arg1, LargeKernel<OP, Prec>(x1), ret1);
+      ret2 = IfThenElse(has_large_arg2, LargeKernel<OP, Prec>(x2), ret2);
+      ret3 = IfThenElse(has_large_arg3, LargeKernel<OP, Prec>(x3), ret3);
+    }
+  }
+  if constexpr (Prec::kExceptions) {
+    prec.Raise(TrigExceptions<OP>(x0) | TrigExceptions<OP>(x1) |
+               TrigExceptions<OP>(x2) | TrigExceptions<OP>(x3));
+  }
+  out0 = ret0;
+  out1 = ret1;
+  out2 = ret2;
+  out3 = ret3;
+}
+
+/**
+ * @brief Applies Trig over a contiguous array.
+ *
+ * The main loop consumes kInterleave (1, 2 or 4) vectors per iteration
+ * through the multi-vector overloads above, then single vectors, and the
+ * remainder is handled with a partial load/store. The zero padding of the
+ * partial load never raises, since sin(0), cos(0) and tan(0) are exact;
+ * cotangent pads with ones instead to stay clear of its pole.
+ */
+template <Operation OP, size_t kInterleave, typename Prec, typename T>
+NPSR_INTRIN void TrigArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  static_assert(kInterleave == 1 || kInterleave == 2 || kInterleave == 4,
+                "Interleave factor must be 1, 2 or 4");
+  const ScalableTag<T> d;
+  using V = Vec<decltype(d)>;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  if constexpr (kInterleave == 4) {
+    for (; i + 4 * N <= count; i += 4 * N) {
+      V y0, y1, y2, y3;
+      Trig<OP>(prec, LoadU(d, in + i), LoadU(d, in + i + N),
+               LoadU(d, in + i + 2 * N), LoadU(d, in + i + 3 * N), y0, y1, y2,
+               y3);
+      StoreU(y0, d, out + i);
+      StoreU(y1, d, out + i + N);
+      StoreU(y2, d, out + i + 2 * N);
+      StoreU(y3, d, out + i + 3 * N);
+    }
+  }
+  if constexpr (kInterleave >= 2) {
+    for (; i + 2 * N <= count; i += 2 * N) {
+      V y0, y1;
+      Trig<OP>(prec, LoadU(d, in + i), LoadU(d, in + i + N), y0, y1);
+      StoreU(y0, d, out + i);
+      StoreU(y1, d, out + i + N);
+    }
+  }
+  for (; i + N <= count; i += N) {
+    StoreU(Trig<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    const V pad = Set(d, static_cast<T>(OP == Operation::kCot ? 1 : 0));
+    V y = Trig<OP>(prec, LoadNOr(pad, d, in + i, remaining));
+    StoreN(y, d, out + i, remaining);
+  }
+}
+
+/**
+ * @brief π-scaled implementation: sin(π·x), cos(π·x) or tan(π·x)
+ *
+ * @tparam OP       Operation type: kSin, kCos or kTan
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * The reduction of PiKernel<> is exact for every finite x, so there is a
+ * single tier: kLowAccuracy and the LargeArgument tags have no effect.
+ * Sine and tangent work on |x| and restore the sign last. With
+ * kSpecialCases, following IEEE 754 sinPi, cosPi and tanPi:
+ * - ±∞ give NaN and raise invalid, NaN propagates.
+ * - sinPi(±n) = ±0 and cosPi(n + 1/2) = +0 for integers n.
+ * - tanPi(n) = ±0 with the sign of sin(π·n)/cos(π·n) taken from the right,
+ *   so -0 for positive odd n, and tanPi(n + 1/2) = ±∞, +∞ for even n,
+ *   raising division by zero.
+ * Without it, zeros may carry either sign and non-finite lanes are
+ * unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V TrigPi(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  (void)prec;
+
+  const V a = Abs(x);
+  V ret = PiKernel<OP>(a);
+  if constexpr (Prec::kSpecialCases) {
+    const V zero = Zero(d);
+    int flags = !AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0;
+    if constexpr (OP == Operation::kTan) {
+      // a mod 2 again, ±1 for odd a and ±1/2 at the poles
+      const V y = ReduceMod2(a);
+      const V y_abs = Abs(y);
+      const auto is_pole = Eq(y_abs, Set(d, static_cast<T>(0.5)));
+      const V odd_zero = Neg(zero);
+      ret = IfThenElse(Eq(ret, zero),
+                       IfThenElse(Eq(y_abs, Set(d, static_cast<T>(1.0))),
+                                  odd_zero, zero),
+                       ret);
+      ret = IfThenElse(is_pole, CopySign(Inf(d), y), ret);
+      flags |= !AllFalse(d, is_pole) ? FPExceptions::kDivByZero : 0;
+    } else {
+      ret = IfThenElse(Eq(ret, zero), zero, ret);
+    }
+    if constexpr (Prec::kExceptions) {
+      prec.Raise(flags);
+    } else {
+      (void)flags;
+    }
+  }
+  if constexpr (OP != Operation::kCos) {
+    ret = Xor(ret, AndNot(a, x));
+  }
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(IsFinite(x), ret, NaN(d));
   }
   return ret;
 }
 
+/**
+ * @brief Applies TrigPi over a contiguous array.
+ *
+ * The remainder is handled with a partial load/store, whose zero padding
+ * never raises.
+ */
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void TrigPiArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(TrigPi<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(TrigPi<OP>(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+/**
+ * @brief Normalized sinc: sin(π·x)/(π·x), and 1 at x = 0
+ *
+ * |x| < 1/4 take SincPoly<>, the others SincKernel<>, which is skipped for
+ * vectors without such lanes only under the default LargeArgument::kBranchy.
+ * No lane ever evaluates 0/0. Like SinPi there is a single accuracy tier.
+ * With kSpecialCases, zeros at the integers are +0, and ±∞ give NaN and
+ * raise invalid, following NumPy's sinc. Without it, non-finite lanes are
+ * unspecified.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Sinc(Prec &prec, V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  (void)prec;
+
+  const V a = Abs(x);
+  const auto is_small = Lt(a, Set(d, kSincPolyBound<T>));
+  V ret = SincPoly(a);
+  if (!Prec::kBranchy || !AllTrue(d, is_small)) {
+    ret = IfThenElse(is_small, ret, SincKernel(a));
+  }
+  if constexpr (Prec::kSpecialCases) {
+    const V zero = Zero(d);
+    ret = IfThenElse(Eq(ret, zero), zero, ret);
+    ret = IfThenElse(IsFinite(x), ret, NaN(d));
+    if constexpr (Prec::kExceptions) {
+      prec.Raise(!AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0);
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Degree implementation: sin(x°), cos(x°) or tan(x°)
+ *
+ * @tparam OP       Operation type: kSin, kCos or kTan
+ * @tparam Prec     Precise configuration class with accuracy/feature flags
+ *
+ * The reduction of DegreeKernel<> is exact in floating point, so there is
+ * a single accuracy tier. |x| ≥ 2^72 are folded first under kLargeArgument,
+ * a branch taken only by vectors holding such lanes under kBranchy;
+ * with kNoLargeArgument they are unspecified. Sine and tangent work on |x|
+ * and restore the sign last. With kSpecialCases, like TrigPi<>:
+ * - ±∞ give NaN and raise invalid, NaN propagates.
+ * - Zeros are +0 before the sign of sine is restored, tan(180°·n) is -0
+ *   for positive odd n, and tan(90° + 180°·n) = ±∞, +∞ for even n,
+ *   raising division by zero.
+ * Without it, zeros may carry either sign and non-finite lanes are
+ * unspecified.
+ */
+template <Operation OP, typename Prec, typename V>
+NPSR_INTRIN V TrigDeg(Prec &prec, V x) {
+  using namespace hn;
+  const DFromV<V> d;
+  (void)prec;
+
+  const V a = Abs(x);
+  V ret = DegreeKernel<OP, Prec>(a);
+  if constexpr (Prec::kSpecialCases) {
+    int flags = !AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0;
+    if constexpr (OP == Operation::kTan) {
+      const auto is_pole = And(IsInf(ret), IsFinite(x));
+      flags |= !AllFalse(d, is_pole) ? FPExceptions::kDivByZero : 0;
+    }
+    if constexpr (Prec::kExceptions) {
+      prec.Raise(flags);
+    } else {
+      (void)flags;
+    }
+  }
+  if constexpr (OP != Operation::kCos) {
+    ret = Xor(ret, AndNot(a, x));
+  }
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(IsFinite(x), ret, NaN(d));
+  }
+  return ret;
+}
+
+/// Applies TrigDeg over a contiguous array, see TrigPiArray.
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void TrigDegArray(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(TrigDeg<OP>(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(TrigDeg<OP>(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
 }  // namespace npsr::HWY_NAMESPACE::trig
 
 // Public API in the main npsr namespace
@@ -147,6 +604,367 @@ NPSR_INTRIN V Cos(Prec &prec, V x) {
   return trig::Trig<trig::Operation::kCos>(prec, x);
 }
 
+/**
+ * @brief Compute sine of two or four vectors at once
+ *
+ * Same results as calling Sin on each vector, but the stages of the
+ * independent inputs are interleaved to keep both FMA ports busy, and the
+ * large argument check is a single branch for the whole group.
+ *
+ * @example
+ * ```cpp
+ * V s0, s1;
+ * Sin(prec, x0, x1, s0, s1);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN void Sin(Prec &prec, V x0, V x1, V &out0, V &out1) {
+  trig::Trig<trig::Operation::kSin>(prec, x0, x1, out0, out1);
+}
+
+template <typename Prec, typename V>
+NPSR_INTRIN void Sin(Prec &prec, V x0, V x1, V x2, V x3, V &out0, V &out1,
+                     V &out2, V &out3) {
+  trig::Trig<trig::Operation::kSin>(prec, x0, x1, x2, x3, out0, out1, out2,
+                                    out3);
+}
+
+/// Compute cosine of two or four vectors at once, see Sin.
+template <typename Prec, typename V>
+NPSR_INTRIN void Cos(Prec &prec, V x0, V x1, V &out0, V &out1) {
+  trig::Trig<trig::Operation::kCos>(prec, x0, x1, out0, out1);
+}
+
+template <typename Prec, typename V>
+NPSR_INTRIN void Cos(Prec &prec, V x0, V x1, V x2, V x3, V &out0, V &out1,
+                     V &out2, V &out3) {
+  trig::Trig<trig::Operation::kCos>(prec, x0, x1, x2, x3, out0, out1, out2,
+                                    out3);
+}
+
+/**
+ * @brief Compute sine over an array
+ *
+ * @tparam kInterleave  Vectors processed per iteration: 1, 2 or 4
+ * @param prec          Precise object managing FP environment
+ * @param in            Input array of `count` elements
+ * @param count         Number of elements
+ * @param out           Output array, may be `in` itself
+ *
+ * In-place calls are supported, every block is loaded before it is stored.
+ * Partially overlapping arrays are not.
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kLowAccuracy};
+ * Sin(prec, input, n, output);
+ * ```
+ */
+template <size_t kInterleave = 4, typename Prec, typename T>
+NPSR_INTRIN void Sin(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigArray<trig::Operation::kSin, kInterleave>(prec, in, count, out);
+}
+
+/// Compute cosine over an array, see the array overload of Sin.
+template <size_t kInterleave = 4, typename Prec, typename T>
+NPSR_INTRIN void Cos(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigArray<trig::Operation::kCos, kInterleave>(prec, in, count, out);
+}
+
+/**
+ * @brief Compute tangent of vector elements with configurable precision
+ *
+ * Shares the reduction tiers and Precise tags of Sin/Cos, then evaluates a
+ * dedicated minimax polynomial around a π/16 table of tangents, with a
+ * single division for both tan and -1/tan. Error: ~0.53 ULP by default
+ * (< 2 ULP without native FMA), ~3-4 ULP with kLowAccuracy.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kLowAccuracy})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       tan(x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kNoLargeArgument};
+ * auto result = Tan(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Tan(Prec &prec, V x) {
+  return trig::Trig<trig::Operation::kTan>(prec, x);
+}
+
+/**
+ * @brief Compute cotangent of vector elements with configurable precision
+ *
+ * Same kernel as Tan with the quadrants swapped, so cot(x) is not rounded
+ * twice as 1/tan(x) would be. cot(±0) = ±∞ and raises division by zero.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Cot(Prec &prec, V x) {
+  return trig::Trig<trig::Operation::kCot>(prec, x);
+}
+
+/// Compute tangent of two or four vectors at once, see Sin.
+template <typename Prec, typename V>
+NPSR_INTRIN void Tan(Prec &prec, V x0, V x1, V &out0, V &out1) {
+  trig::Trig<trig::Operation::kTan>(prec, x0, x1, out0, out1);
+}
+
+template <typename Prec, typename V>
+NPSR_INTRIN void Tan(Prec &prec, V x0, V x1, V x2, V x3, V &out0, V &out1,
+                     V &out2, V &out3) {
+  trig::Trig<trig::Operation::kTan>(prec, x0, x1, x2, x3, out0, out1, out2,
+                                    out3);
+}
+
+/// Compute cotangent of two or four vectors at once, see Sin.
+template <typename Prec, typename V>
+NPSR_INTRIN void Cot(Prec &prec, V x0, V x1, V &out0, V &out1) {
+  trig::Trig<trig::Operation::kCot>(prec, x0, x1, out0, out1);
+}
+
+template <typename Prec, typename V>
+NPSR_INTRIN void Cot(Prec &prec, V x0, V x1, V x2, V x3, V &out0, V &out1,
+                     V &out2, V &out3) {
+  trig::Trig<trig::Operation::kCot>(prec, x0, x1, x2, x3, out0, out1, out2,
+                                    out3);
+}
+
+/// Compute tangent over an array, see the array overload of Sin.
+template <size_t kInterleave = 4, typename Prec, typename T>
+NPSR_INTRIN void Tan(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigArray<trig::Operation::kTan, kInterleave>(prec, in, count, out);
+}
+
+/// Compute cotangent over an array, see the array overload of Sin.
+template <size_t kInterleave = 4, typename Prec, typename T>
+NPSR_INTRIN void Cot(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigArray<trig::Operation::kCot, kInterleave>(prec, in, count, out);
+}
+
+/**
+ * @brief Compute sin(π·x) of vector elements
+ *
+ * x is reduced modulo 2 exactly, with a single round, and the remainder goes
+ * through the π/16 table of Sin, so the result stays accurate for every
+ * finite x without any large argument tier, and is exact at multiples of
+ * 1/2. Error: ~0.5 ULP (~1 ULP for double without native FMA), whatever
+ * the accuracy tags.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kNoSpecialCases})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       sin(π·x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kNoExceptions};
+ * auto result = SinPi(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V SinPi(Prec &prec, V x) {
+  return trig::TrigPi<trig::Operation::kSin>(prec, x);
+}
+
+/// Compute cos(π·x) of vector elements, see SinPi.
+template <typename Prec, typename V>
+NPSR_INTRIN V CosPi(Prec &prec, V x) {
+  return trig::TrigPi<trig::Operation::kCos>(prec, x);
+}
+
+/**
+ * @brief Compute tan(π·x) of vector elements, see SinPi.
+ *
+ * The remainder goes through the kernel of Tan. ~0.53 ULP error (~1.5 ULP
+ * for double without native FMA), ±∞ at half-integers.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V TanPi(Prec &prec, V x) {
+  return trig::TrigPi<trig::Operation::kTan>(prec, x);
+}
+
+/// Compute sin(π·x) over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void SinPi(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigPiArray<trig::Operation::kSin>(prec, in, count, out);
+}
+
+/// Compute cos(π·x) over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void CosPi(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigPiArray<trig::Operation::kCos>(prec, in, count, out);
+}
+
+/// Compute tan(π·x) over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void TanPi(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigPiArray<trig::Operation::kTan>(prec, in, count, out);
+}
+
+/**
+ * @brief Compute the normalized sinc, sin(π·x)/(π·x), of vector elements
+ *
+ * Matches np.sinc in a single pass: an even polynomial for |x| < 1/4, so
+ * sinc(0) = 1 with no 0/0 to patch, and elsewhere the exact reduction of
+ * SinPi over π·x, both kept as double-words for a single division.
+ * Exact zeros at the integers. Error: ~0.65 ULP (~1.6 ULP for double
+ * without native FMA), whatever the accuracy tags.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kNoSpecialCases})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       sinc(x) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kNoExceptions};
+ * auto result = Sinc(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V Sinc(Prec &prec, V x) {
+  return trig::Sinc(prec, x);
+}
+
+/// Compute the normalized sinc over an array, see the vector overload.
+template <typename Prec, typename T>
+NPSR_INTRIN void Sinc(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(trig::Sinc(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(trig::Sinc(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
+/**
+ * @brief Compute sin(x) of vector elements in degrees
+ *
+ * x is reduced modulo 360 and then 90 exactly in floating point, with no
+ * Payne-Hanek tier, and the small remainder is scaled into radians by a
+ * hi/lo π/180 before the π/16 table of Sin. Exact at multiples of 30° and
+ * 90°. Error: ~0.5 ULP (~1 ULP for double without native FMA), whatever
+ * the accuracy tags; huge x need the default kLargeArgument.
+ *
+ * @tparam Prec  Precise configuration (e.g., Precise{kNoSpecialCases})
+ * @tparam V     Highway vector type
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector, in degrees
+ * @return       sin(x°) for each element
+ *
+ * @example
+ * ```cpp
+ * Precise prec{kNoExceptions};
+ * auto result = SinD(prec, input_vector);
+ * ```
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V SinD(Prec &prec, V x) {
+  return trig::TrigDeg<trig::Operation::kSin>(prec, x);
+}
+
+/// Compute cos(x) of vector elements in degrees, see SinD.
+template <typename Prec, typename V>
+NPSR_INTRIN V CosD(Prec &prec, V x) {
+  return trig::TrigDeg<trig::Operation::kCos>(prec, x);
+}
+
+/**
+ * @brief Compute tan(x) of vector elements in degrees, see SinD.
+ *
+ * The remainder goes through the kernel of Tan. Exact at multiples of 45°,
+ * ±∞ at odd multiples of 90°. ~0.53 ULP error (~1.5 ULP for double without
+ * native FMA).
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V TanD(Prec &prec, V x) {
+  return trig::TrigDeg<trig::Operation::kTan>(prec, x);
+}
+
+/// Compute sin(x) in degrees over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void SinD(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigDegArray<trig::Operation::kSin>(prec, in, count, out);
+}
+
+/// Compute cos(x) in degrees over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void CosD(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigDegArray<trig::Operation::kCos>(prec, in, count, out);
+}
+
+/// Compute tan(x) in degrees over an array, see the array overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void TanD(Prec &prec, const T *in, size_t count, T *out) {
+  trig::TrigDegArray<trig::Operation::kTan>(prec, in, count, out);
+}
+
+/**
+ * @brief Reduce x modulo π/2: x = n·π/2 + r_hi + r_lo
+ *
+ * The same reduction tiers as Sin/Cos, selected by the same Precise tags, so
+ * custom periodic kernels get identical speed and exactness.
+ *
+ * @param prec      Precise object managing FP environment
+ * @param x         Input vector
+ * @param quadrant  n mod 4 in [0, 3], a signed integer vector
+ * @param r_hi      Leading part of the remainder, |r_hi| ≲ π/4
+ * @param r_lo      Trailing part, zero under kLowAccuracy
+ *
+ * @example
+ * ```cpp
+ * Vec<RebindToSigned<decltype(d)>> q;
+ * V r_hi, r_lo;
+ * ReducePiDiv2(prec, x, q, r_hi, r_lo);
+ * ```
+ */
+template <typename Prec, typename V, typename VI>
+NPSR_INTRIN void ReducePiDiv2(Prec &prec, V x, VI &quadrant, V &r_hi,
+                              V &r_lo) {
+  trig::ReducePiDiv2(prec, x, quadrant, r_hi, r_lo);
+}
+
+/**
+ * @brief Wrap angles into [-π, π]
+ *
+ * @param prec   Precise object managing FP environment
+ * @param x      Input vector
+ * @return       x - 2π·round(x/2π)
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V WrapAngle(Prec &prec, V x) {
+  return trig::WrapAngle(prec, x);
+}
+
+/// Wrap an array of angles into [-π, π], see the vector overload.
+template <typename Prec, typename T>
+NPSR_INTRIN void WrapAngle(Prec &prec, const T *in, size_t count, T *out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  for (; i + N <= count; i += N) {
+    StoreU(trig::WrapAngle(prec, LoadU(d, in + i)), d, out + i);
+  }
+  if (i < count) {
+    const size_t remaining = count - i;
+    StoreN(trig::WrapAngle(prec, LoadN(d, in + i, remaining)), d, out + i,
+           remaining);
+  }
+}
+
 }  // namespace npsr::HWY_NAMESPACE
 
 HWY_AFTER_NAMESPACE();
@@ -6,144 +6,192 @@
 #endif
 
 #include "npsr/hwy.h"
+#include "npsr/poly-inl.h"
 #include "npsr/trig/data/data.h"
+#include "npsr/trig/staged-inl.h"
 
 HWY_BEFORE_NAMESPACE();
 
 namespace npsr::HWY_NAMESPACE::trig {
 
-enum class Operation { kSin = 0, kCos = 1 };
-
-template <Operation OP, typename V, HWY_IF_F32(TFromV<V>)>
-NPSR_INTRIN V PolyLow(V r, V r2) {
-  using namespace hn;
-
-  const DFromV<V> d;
-  constexpr bool kCos = OP == Operation::kCos;
-  const V c9 = Set(d, kCos ? 0x1.5d866ap-19f : 0x1.5dbdfp-19f);
-  const V c7 = Set(d, kCos ? -0x1.9f6d9ep-13 : -0x1.9f6ffep-13f);
-  const V c5 = Set(d, kCos ? 0x1.110ec8p-7 : 0x1.110eccp-7f);
-  const V c3 = Set(d, -0x1.55554cp-3f);
-  V poly = MulAdd(c9, r2, c7);
-  poly = MulAdd(r2, poly, c5);
-  poly = MulAdd(r2, poly, c3);
-  if constexpr (OP == Operation::kCos) {
-    // Although this path handles cosine, we have already transformed the
-    // input using the identity: cos(x) = sin(x + π/2) This means we're no
-    // longer directly evaluating a cosine Taylor series; instead, we evaluate
-    // the sine approximation polynomial at (x + π/2).
-    //
-    // The sine approximation has the general form:
-    //    sin(r) ≈ r + r³ · P(r²)
-    //
-    // So, we compute:
-    //    r³ = r · r²
-    //    sin(r) ≈ r + r³ · poly
-    //
-    // This formulation preserves accuracy by computing the highest order
-    // terms last, which benefits from FMA to reduce rounding error.
-    V r3 = Mul(r2, r);
-    poly = MulAdd(r3, poly, r);
+// Low<>, High<>, Extended<> and Small<> implement kSin and kCos, the
+// tangent kernels of tan-inl.h implement kTan and kCot
+enum class Operation { kSin = 0, kCos = 1, kTan = 2, kCot = 3 };
+
+/**
+ * Accuracy ladder for kMaxULP<N>: the lowest polynomial degree from
+ * data/ladder.h whose measured max error over Low<> stays within `max_ulp`.
+ * 0 keeps the default polynomials below (degree 9 for float, 15 for double).
+ *
+ * Measured max error of each rung (|x| < 10^4, with and without FMA):
+ * | type   | degree | max ULP   | rung           |
+ * |--------|--------|-----------|----------------|
+ * | float  | 7      | 29        | kMaxULP<32>    |
+ * | float  | 5      | 3907      | kMaxULP<4096>  |
+ * | double | 13     | 2575      | kMaxULP<4096>  |
+ * | double | 11     | 846940    | kMaxULP<2^20>  |
+ * | double | 9      | 1.19e8    | kMaxULP<2^27>  |
+ *
+ * The Cody-Waite reduction keeps its full precision on every rung, since
+ * near multiples of π the ULP error is dominated by the reduction rather
+ * than the polynomial.
+ */
+template <typename T>
+constexpr int LowDegree(int max_ulp) {
+  if constexpr (std::is_same_v<T, float>) {
+    return max_ulp >= 4096 ? 5 : max_ulp >= 32 ? 7 : 0;
   } else {
-    poly = Mul(poly, r2);
-    poly = MulAdd(r, poly, r);
+    return max_ulp >= (1 << 27)   ? 9
+           : max_ulp >= (1 << 20) ? 11
+           : max_ulp >= 4096      ? 13
+                                  : 0;
   }
-  return poly;
 }
 
-template <Operation OP, typename V, HWY_IF_F64(TFromV<V>)>
-NPSR_INTRIN V PolyLow(V r, V r2) {
-  using namespace hn;
-
-  const DFromV<V> d;
-  const V c15 = Set(d, -0x1.9f1517e9f65fp-41);
-  const V c13 = Set(d, 0x1.60e6bee01d83ep-33);
-  const V c11 = Set(d, -0x1.ae6355aaa4a53p-26);
-  const V c9 = Set(d, 0x1.71de3806add1ap-19);
-  const V c7 = Set(d, -0x1.a01a019a659ddp-13);
-  const V c5 = Set(d, 0x1.111111110a573p-7);
-  const V c3 = Set(d, -0x1.55555555554a8p-3);
-  V poly = MulAdd(c15, r2, c13);
-  poly = MulAdd(r2, poly, c11);
-  poly = MulAdd(r2, poly, c9);
-  poly = MulAdd(r2, poly, c7);
-  poly = MulAdd(r2, poly, c5);
-  poly = MulAdd(r2, poly, c3);
-  return poly;
-}
-
-template <Operation OP, typename V>
-NPSR_INTRIN V Low(V x) {
-  using namespace hn;
-  using hwy::SignMask;
-  namespace data = ::npsr::trig::data;
-
-  const DFromV<V> d;
-  const RebindToUnsigned<decltype(d)> du;
-  using T = TFromV<V>;
-  // Load frequently used constants as vector registers
-  const V abs_mask = BitCast(d, Set(du, SignMask<T>() - 1));
-  const V x_abs = And(abs_mask, x);
-  const V x_sign = AndNot(x_abs, x);
-
-  constexpr bool kIsSingle = std::is_same_v<T, float>;
-  // Transform cosine to sine using identity: cos(x) = sin(x + π/2)
-  const V half_pi = Set(d, data::kHalfPi<T>);
-  V x_trans = x_abs;
-  if constexpr (OP == Operation::kCos) {
-    x_trans = Add(x_abs, half_pi);
-  }
-  // check zero input/subnormal for cosine (cos(~0) = 1)
-  const auto is_cos_near_zero = Eq(x_trans, half_pi);
-
-  // Compute N = round(x/π) using "magic number" technique
-  // and stores integer part in mantissa
-  const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
-  V n_biased = MulAdd(x_trans, Set(d, data::kInvPi<T>), magic_round);
-  V n = Sub(n_biased, magic_round);
-
-  // Adjust quotient for cosine (accounts for π/2 phase shift)
-  if constexpr (OP == Operation::kCos) {
-    // For cosine, we computed N = round((x + π/2)/π) but need N' for x:
-    //   N = round((x + π/2)/π) = round(x/π + 0.5)
-    // This is often 1 more than round(x/π), so we subtract 0.5:
-    //   N' = N - 0.5
-    n = Sub(n, Set(d, static_cast<T>(0.5)));
+// Minimax P(r²) coefficients of Low<>, c9 down to c3 for float with one
+// set per operation, c15 down to c3 for double
+constexpr float kLowPolyF32[2][4] = {
+    {0x1.5dbdfp-19f, -0x1.9f6ffep-13f, 0x1.110eccp-7f, -0x1.55554cp-3f},
+    {0x1.5d866ap-19f, -0x1.9f6d9ep-13f, 0x1.110ec8p-7f, -0x1.55554cp-3f},
+};
+constexpr double kLowPolyF64[7] = {
+    -0x1.9f1517e9f65fp-41, 0x1.60e6bee01d83ep-33, -0x1.ae6355aaa4a53p-26,
+    0x1.71de3806add1ap-19, -0x1.a01a019a659ddp-13, 0x1.111111110a573p-7,
+    -0x1.55555555554a8p-3};
+
+/**
+ * Stages of Low<>, see Staged<>: s = n biased, r0 + r1 the Cody-Waite
+ * remainder, a0 = r0².
+ */
+template <Operation OP, int kDeg, typename T>
+struct LowStages {
+  static constexpr size_t kChains = 1;
+  template <class D>
+  using PolyTag = D;
+
+  static constexpr const auto &Coeffs0() {
+    namespace data = ::npsr::trig::data;
+    if constexpr (kDeg != 0) {
+      // Both operations share the rung, cosine being sin(x + π/2)
+      return data::kSinLadder<T, kDeg>;
+    } else if constexpr (std::is_same_v<T, float>) {
+      return kLowPolyF32[static_cast<int>(OP)];
+    } else {
+      return kLowPolyF64;
+    }
   }
-  // Use Cody-Waite method with triple-precision PI
-  constexpr auto kPi = data::kPi<T, kNativeFMA>;
-
-  V r = NegMulAdd(n, Set(d, kPi[0]), x_abs);
-  r = NegMulAdd(n, Set(d, kPi[1]), r);
-  V r_lo = NegMulAdd(n, Set(d, kPi[2]), r);
-  if constexpr (!kNativeFMA) {
-    if (!kIsSingle) {
+  static constexpr const auto &Coeffs1() { return Coeffs0(); }
+
+  template <typename V>
+  NPSR_INTRIN void Reduce(V x, V &n_biased, V &r, V &r_lo, V &r2, V &a1) {
+    using namespace hn;
+    using hwy::SignMask;
+    namespace data = ::npsr::trig::data;
+
+    const DFromV<V> d;
+    const RebindToUnsigned<decltype(d)> du;
+    // Load frequently used constants as vector registers
+    const V abs_mask = BitCast(d, Set(du, SignMask<T>() - 1));
+    const V x_abs = And(abs_mask, x);
+
+    constexpr bool kIsSingle = std::is_same_v<T, float>;
+    // Transform cosine to sine using identity: cos(x) = sin(x + π/2)
+    V x_trans = x_abs;
+    if constexpr (OP == Operation::kCos) {
+      x_trans = Add(x_abs, Set(d, data::kHalfPi<T>));
+    }
+
+    // Compute N = round(x/π) using "magic number" technique
+    // and stores integer part in mantissa
+    const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
+    n_biased = MulAdd(x_trans, Set(d, data::kInvPi<T>), magic_round);
+    V n = Sub(n_biased, magic_round);
+
+    // Adjust quotient for cosine (accounts for π/2 phase shift)
+    if constexpr (OP == Operation::kCos) {
+      // For cosine, we computed N = round((x + π/2)/π) but need N' for x:
+      //   N = round((x + π/2)/π) = round(x/π + 0.5)
+      // This is often 1 more than round(x/π), so we subtract 0.5:
+      //   N' = N - 0.5
+      n = Sub(n, Set(d, static_cast<T>(0.5)));
+    }
+    // Use Cody-Waite method with triple-precision PI
+    constexpr auto kPi = data::kPi<T, kNativeFMA>;
+
+    r = NegMulAdd(n, Set(d, kPi[0]), x_abs);
+    r = NegMulAdd(n, Set(d, kPi[1]), r);
+    r_lo = NegMulAdd(n, Set(d, kPi[2]), r);
+    if constexpr (!kNativeFMA) {
+      if (!kIsSingle) {
+        r = r_lo;
+      }
+      r_lo = NegMulAdd(n, Set(d, kPi[3]), r_lo);
+    }
+
+    if constexpr (kIsSingle) {
       r = r_lo;
     }
-    r_lo = NegMulAdd(n, Set(d, kPi[3]), r_lo);
+    r2 = Mul(r, r);
+    a1 = r2;
   }
 
-  if constexpr (kIsSingle) {
-    r = r_lo;
-  }
-  V r2 = Mul(r, r);
-  V poly = PolyLow<OP>(r, r2);
+  template <typename V>
+  NPSR_INTRIN V Finish(V x, V n_biased, V r, V r_lo, V r2, V, V poly, V) {
+    using namespace hn;
+    using hwy::SignMask;
+    namespace data = ::npsr::trig::data;
+
+    const DFromV<V> d;
+    const RebindToUnsigned<decltype(d)> du;
+    const V abs_mask = BitCast(d, Set(du, SignMask<T>() - 1));
+    const V x_abs = And(abs_mask, x);
+    const V x_sign = AndNot(x_abs, x);
+
+    if constexpr (!std::is_same_v<T, float>) {
+      V r2_corr = Mul(r2, r_lo);
+      poly = MulAdd(r2_corr, poly, r_lo);
+    } else if constexpr (kDeg == 0 && OP == Operation::kCos) {
+      // Although this path handles cosine, we have already transformed the
+      // input using the identity: cos(x) = sin(x + π/2) This means we're no
+      // longer directly evaluating a cosine Taylor series; instead, we
+      // evaluate the sine approximation polynomial at (x + π/2).
+      //
+      // The sine approximation has the general form:
+      //    sin(r) ≈ r + r³ · P(r²)
+      //
+      // So, we compute:
+      //    r³ = r · r²
+      //    sin(r) ≈ r + r³ · poly
+      //
+      // This formulation preserves accuracy by computing the highest order
+      // terms last, which benefits from FMA to reduce rounding error.
+      V r3 = Mul(r2, r);
+      poly = MulAdd(r3, poly, r);
+    } else {
+      poly = Mul(poly, r2);
+      poly = MulAdd(r, poly, r);
+    }
 
-  if constexpr (!kIsSingle) {
-    V r2_corr = Mul(r2, r_lo);
-    poly = MulAdd(r2_corr, poly, r_lo);
+    // Extract octant sign information from quotient and flip the sign bit
+    poly = Xor(poly,
+               BitCast(d, ShiftLeft<sizeof(T) * 8 - 1>(BitCast(du, n_biased))));
+    if constexpr (OP == Operation::kCos) {
+      // check zero input/subnormal for cosine (cos(~0) = 1)
+      const V half_pi = Set(d, data::kHalfPi<T>);
+      const auto is_cos_near_zero = Eq(Add(x_abs, half_pi), half_pi);
+      poly = IfThenElse(is_cos_near_zero, Set(d, static_cast<T>(1.0)), poly);
+    } else {
+      // Restore original sign for sine (odd function)
+      poly = Xor(poly, x_sign);
+    }
+    return poly;
   }
+};
 
-  // Extract octant sign information from quotient and flip the sign bit
-  poly = Xor(poly,
-             BitCast(d, ShiftLeft<sizeof(T) * 8 - 1>(BitCast(du, n_biased))));
-  if constexpr (OP == Operation::kCos) {
-    poly = IfThenElse(is_cos_near_zero, Set(d, static_cast<T>(1.0)), poly);
-  } else {
-    // Restore original sign for sine (odd function)
-    poly = Xor(poly, x_sign);
-  }
-  return poly;
+template <Operation OP, int kMaxULPBudget = 0, typename V>
+NPSR_INTRIN V Low(V x) {
+  using T = hn::TFromV<V>;
+  return Staged<LowStages<OP, LowDegree<T>(kMaxULPBudget), T>>(x);
 }
 // NOLINTNEXTLINE(google-readability-namespace-comments)
 }  // namespace npsr::HWY_NAMESPACE::trig
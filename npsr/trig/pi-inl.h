@@ -0,0 +1,194 @@
+#if defined(NPSR_TRIG_PI_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_PI_INL_H_
+#undef NPSR_TRIG_PI_INL_H_
+#else
+#define NPSR_TRIG_PI_INL_H_
+#endif
+
+#include "npsr/dw-inl.h"  // TwoProd
+#include "npsr/hwy.h"
+#include "npsr/trig/data/data.h"
+#include "npsr/trig/high-inl.h"  // KPi16Reconstruct
+#include "npsr/trig/low-inl.h"   // Operation
+#include "npsr/trig/tan-inl.h"   // TanReduced
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+/**
+ * Exact reduction of the π-scaled argument: y = a - 2·round(a/2), so
+ * a ≡ y (mod 2) and |y| ≤ 1. a/2 and 2·round(a/2) are exact, and the
+ * difference is exact as both are multiples of ulp(a) within 1 of each
+ * other. Past 2^digits, a is even and y is zero.
+ */
+template <typename V>
+NPSR_INTRIN V ReduceMod2(V a) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  V half_n = Round(Mul(a, Set(d, static_cast<T>(0.5))));
+  return NegMulAdd(half_n, Set(d, static_cast<T>(2.0)), a);
+}
+
+/**
+ * π·r as a double-word hi + lo for an exact r, the product by TwoProd<>
+ * and the tail of π by one FMA, so the remainder in radians is as accurate as
+ * that of the Cody-Waite tiers without any of their cancellation.
+ */
+template <typename V>
+NPSR_INTRIN V MulPi(V r, V &lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  constexpr auto kPi = data::kPi<T, true>;
+  V p_lo;
+  V p_hi = TwoProd(r, Set(d, kPi[0]), p_lo);
+  lo = MulAdd(r, Set(d, kPi[1]), p_lo);
+  return p_hi;
+}
+
+/**
+ * sin(π·a) or cos(π·a) as a double-word hi + lo, the sine and cosine steps
+ * of PiKernel<> below, see KPi16Reconstruct<>.
+ */
+template <Operation OP, typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V PiKernel(V a, V &lo) {
+  using namespace hn;
+  static_assert(OP == Operation::kSin || OP == Operation::kCos,
+                "Only sine and cosine have a double-word form");
+  const DFromV<V> d;
+  const V magic = Set(d, 0x1.8p52);
+  const V y = ReduceMod2(a);
+  V n_biased = MulAdd(y, Set(d, 16.0), magic);
+  V n = Sub(n_biased, magic);
+  V r = NegMulAdd(n, Set(d, 1.0 / 16), y);
+  V theta_lo;
+  V theta = MulPi(r, theta_lo);
+  return KPi16Reconstruct<OP>(n_biased, theta, theta_lo, lo);
+}
+
+/**
+ * This function computes sin(π·a), cos(π·a) or tan(π·a) for a = |x|, the
+ * sign of sine and tangent being restored by the caller.
+ *
+ * Algorithm Overview:
+ * 1. Exact Reduction: y = a mod 2 by ReduceMod2<>, then
+ *    - sin/cos: n = round(16·y), r = y - n/16, |r| ≤ 1/32
+ *    - tan: q = round(2·y), r = y - q/2, |r| ≤ 1/4
+ *    Both steps are exact, so unlike sin(x) there is no representation
+ *    error of π to fight and no large argument tier; huge a simply give
+ *    y = 0.
+ *
+ * 2. Radians: θ = π·r as a double-word, see MulPi<>
+ *
+ * 3. Reconstruction: θ and n go through the π/16 table of High<>, see
+ *    KPi16Reconstruct<>, and θ and q through TanReduced<>
+ *
+ * Multiples of 1/16 give θ = 0 and return the table entries themselves, so
+ * integers and half-integers give exact zeros and ±1, and ±∞ for tangent.
+ * Error for double: ~0.52 ULP for sine and cosine, ~0.53 ULP for tangent,
+ * ~1 and ~1.5 ULP without native FMA, as for Sin and Tan.
+ */
+template <Operation OP, typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V PiKernel(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  if constexpr (OP == Operation::kTan) {
+    const RebindToSigned<decltype(d)> di;
+    const V magic = Set(d, 0x1.8p52);
+    const V y = ReduceMod2(a);
+    V q_biased = Add(Add(y, y), magic);
+    V q = Sub(q_biased, magic);
+    V r = NegMulAdd(q, Set(d, 0.5), y);
+    V theta_lo;
+    V theta = MulPi(r, theta_lo);
+    const auto quadrant = And(BitCast(di, q_biased), Set(di, 3));
+    return TanReduced<OP, true>(quadrant, theta, theta_lo);
+  } else {
+    V lo;  // only the rounded result is needed
+    return PiKernel<OP>(a, lo);
+  }
+}
+
+/**
+ * Float goes through the double kernel above, like High<> for float widens
+ * its polynomial, so the result is rounded once, ~0.5 ULP error.
+ */
+template <Operation OP, typename V, HWY_IF_F32(TFromV<V>)>
+NPSR_INTRIN V PiKernel(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  const Half<decltype(d)> dh;
+  const RepartitionToWide<decltype(d)> dw;
+  auto lo = DemoteTo(dh, PiKernel<OP>(PromoteLowerTo(dw, a)));
+  auto up = DemoteTo(dh, PiKernel<OP>(PromoteUpperTo(dw, a)));
+  return Combine(d, up, lo);
+}
+
+// Bound of the sinc polynomial, see npsr/trig/data/sinc.h.sol
+template <typename T>
+inline constexpr T kSincPolyBound = static_cast<T>(0.25);
+
+/**
+ * This function computes sinc(x) ≈ 1 + w·P(w), w = x², for |x| < 1/4 with a
+ * minimax polynomial generated by npsr/trig/data/sinc.h.sol. The correction
+ * is above -0.1, so adding 1 last rounds once, ~0.6 ULP error near the
+ * bound.
+ */
+template <typename V>
+NPSR_INTRIN V SincPoly(V x) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  V w = Mul(x, x);
+  return MulAdd(w, Poly(w, data::kSincPoly<T>), Set(d, static_cast<T>(1.0)));
+}
+
+/**
+ * This function computes sin(π·a)/(π·a) for a = |x| ≥ 1/4.
+ *
+ * Both sides are double-words, sin(π·a) from PiKernel<> and π·a from
+ * MulPi<>, so the quotient takes a single division for the reciprocal and
+ * is refined by the remainder, as in TanReduced<>, ~0.55 ULP error with
+ * native FMA and ~1.6 ULP without, where the remainder is no longer exact.
+ * π·a is taken at a clamped to 2^52, past which a is an integer and the
+ * numerator is zero anyway, so it can't overflow.
+ */
+template <typename V, HWY_IF_F64(TFromV<V>)>
+NPSR_INTRIN V SincKernel(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  const V one = Set(d, 1.0);
+  V s_lo;
+  V s_hi = PiKernel<Operation::kSin>(a, s_lo);
+  V p_lo;
+  V p_hi = MulPi(Min(a, Set(d, 0x1p52)), p_lo);
+  V recip = Div(one, p_hi);
+  V q = Mul(s_hi, recip);
+  V rem = NegMulAdd(q, p_hi, s_hi);
+  rem = Add(rem, s_lo);
+  rem = NegMulAdd(q, p_lo, rem);
+  return MulAdd(rem, recip, q);
+}
+
+/// Float widens to the double kernel, see PiKernel<>.
+template <typename V, HWY_IF_F32(TFromV<V>)>
+NPSR_INTRIN V SincKernel(V a) {
+  using namespace hn;
+  const DFromV<V> d;
+  const Half<decltype(d)> dh;
+  const RepartitionToWide<decltype(d)> dw;
+  auto lo = DemoteTo(dh, SincKernel(PromoteLowerTo(dw, a)));
+  auto up = DemoteTo(dh, SincKernel(PromoteUpperTo(dw, a)));
+  return Combine(d, up, lo);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_PI_INL_H_
@@ -0,0 +1,248 @@
+#if defined(NPSR_TRIG_PLAN_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_PLAN_INL_H_
+#undef NPSR_TRIG_PLAN_INL_H_
+#else
+#define NPSR_TRIG_PLAN_INL_H_
+#endif
+
+#include <hwy/aligned_allocator.h>
+
+#include "npsr/hwy.h"
+#include "npsr/precise.h"
+#include "npsr/trig/reduce-inl.h"  // ReducePiDiv2
+#include "npsr/trig/small-inl.h"   // SmallSin, SmallCos
+#include "npsr/trig/tan-inl.h"     // TanReduced
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE {
+
+/**
+ * @brief Reduced form of an angle array, for repeated sin/cos evaluation
+ *
+ * Runs ReducePiDiv2 once over the input and keeps, per element, the
+ * quadrant as one byte and the remainder r_hi + r_lo in three aligned SoA
+ * buffers. Sin, Cos and SinCos over the plan then only evaluate the
+ * |r| ≲ π/4 polynomials of Small<> and pick the quadrant, with no
+ * reduction, table lookup or large argument branch. Tan and Cot only run the tangent kernel on the
+ * stored remainder.
+ *
+ * Memory versus recompute:
+ * - The plan costs 2·sizeof(T) + 1 bytes per element (r_hi, r_lo and the
+ *   quadrant), 17 for double and 9 for float, i.e. 2.125 and 2.25 times the
+ *   input, and every evaluation streams all of it back.
+ * - It pays off when the reduction dominates: High<> spends roughly half of
+ *   its work reducing and looking up, and a lane on the Extended<> path
+ *   costs several times a standard one. With mostly small arguments and
+ *   kLowAccuracy, recomputing from the input is about as fast and reads
+ *   less than half of the memory.
+ *
+ * The accuracy tier is fixed when the plan is built: the Precise used there
+ * decides Cody-Waite vs compensated vs Payne-Hanek, exactly as for
+ * ReducePiDiv2, and raises the FP exceptions of the input. Evaluation does
+ * not raise.
+ *
+ * @example
+ * ```cpp
+ * Precise prec{};
+ * ReductionPlan<double> plan(prec, angles, n);
+ * for (int it = 0; it < iterations; ++it) {
+ *   SinCos(prec, plan, sin_out, cos_out);
+ *   ...
+ * }
+ * ```
+ */
+template <typename T>
+class ReductionPlan {
+ public:
+  template <typename Prec>
+  ReductionPlan(Prec &prec, const T *HWY_RESTRICT in, size_t count)
+      : count_(count) {
+    using namespace hn;
+    const ScalableTag<T> d;
+    const RebindToSigned<decltype(d)> di;
+    const Rebind<uint8_t, decltype(d)> d8;
+    using V = Vec<decltype(d)>;
+    using VI = Vec<decltype(di)>;
+    const size_t N = Lanes(d);
+    // Padded to whole vectors so evaluation loads never go out of bounds
+    const size_t padded = (count + N - 1) / N * N;
+    quadrant_ = hwy::AllocateAligned<uint8_t>(padded);
+    r_hi_ = hwy::AllocateAligned<T>(padded);
+    r_lo_ = hwy::AllocateAligned<T>(padded);
+
+    for (size_t i = 0; i < padded; i += N) {
+      V x = i + N <= count ? LoadU(d, in + i) : LoadN(d, in + i, count - i);
+      VI quadrant;
+      V r_hi, r_lo;
+      trig::ReducePiDiv2(prec, x, quadrant, r_hi, r_lo);
+      // In [0, 3], the narrowing is exact
+      StoreU(DemoteTo(d8, quadrant), d8, quadrant_.get() + i);
+      Store(r_hi, d, r_hi_.get() + i);
+      Store(r_lo, d, r_lo_.get() + i);
+    }
+  }
+
+  size_t Count() const { return count_; }
+  /// n mod 4 of each element, x = n·π/2 + r
+  const uint8_t *Quadrant() const { return quadrant_.get(); }
+  /// Leading part of the remainder r
+  const T *RHi() const { return r_hi_.get(); }
+  /// Trailing part of the remainder r
+  const T *RLo() const { return r_lo_.get(); }
+
+ private:
+  size_t count_;
+  hwy::AlignedFreeUniquePtr<uint8_t[]> quadrant_;
+  hwy::AlignedFreeUniquePtr<T[]> r_hi_;
+  hwy::AlignedFreeUniquePtr<T[]> r_lo_;
+};
+
+namespace trig {
+
+/**
+ * Evaluates sin and/or cos of q·π/2 + r from one planned vector.
+ *
+ * sin(q·π/2 + r) is ±sin(r) for even q and ±cos(r) for odd q, negated when
+ * bit 1 of q is set; cos shifts q by one.
+ */
+template <bool kSin, bool kCos, typename Prec, typename V, typename VI>
+NPSR_INTRIN void PlanSinCos(VI quadrant, V r_hi, V r_lo, V &sin_out,
+                            V &cos_out) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const VI one = Set(di, 1);
+  const VI two = Set(di, 2);
+
+  V sin_r = SmallSin(r_hi, r_lo);
+  V cos_r = SmallCos(r_hi, r_lo);
+  if constexpr (Prec::kSpecialCases) {
+    // -0.0 should return -0.0 for sine
+    sin_r = IfThenElse(Eq(r_hi, Zero(d)), r_hi, sin_r);
+  }
+  const auto is_odd = RebindMask(d, Eq(And(quadrant, one), one));
+  if constexpr (kSin) {
+    V ret = IfThenElse(is_odd, cos_r, sin_r);
+    VI sign = ShiftLeft<sizeof(T) * 8 - 2>(And(quadrant, two));
+    sin_out = Xor(ret, BitCast(d, sign));
+  }
+  if constexpr (kCos) {
+    V ret = IfThenElse(is_odd, sin_r, cos_r);
+    VI sign = ShiftLeft<sizeof(T) * 8 - 2>(And(Add(quadrant, one), two));
+    cos_out = Xor(ret, BitCast(d, sign));
+  }
+}
+
+template <bool kSin, bool kCos, typename Prec, typename T>
+NPSR_INTRIN void PlanArray(const ReductionPlan<T> &plan, T *HWY_RESTRICT sin_out,
+                           T *HWY_RESTRICT cos_out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const RebindToSigned<decltype(d)> di;
+  const Rebind<uint8_t, decltype(d)> d8;
+  using V = Vec<decltype(d)>;
+  const size_t N = Lanes(d);
+  const size_t count = plan.Count();
+  for (size_t i = 0; i < count; i += N) {
+    V sin_v, cos_v;
+    PlanSinCos<kSin, kCos, Prec>(
+        PromoteTo(di, LoadU(d8, plan.Quadrant() + i)), Load(d, plan.RHi() + i),
+        Load(d, plan.RLo() + i), sin_v, cos_v);
+    const size_t remaining = count - i;
+    if (HWY_LIKELY(remaining >= N)) {
+      if constexpr (kSin) StoreU(sin_v, d, sin_out + i);
+      if constexpr (kCos) StoreU(cos_v, d, cos_out + i);
+    } else {
+      if constexpr (kSin) StoreN(sin_v, d, sin_out + i, remaining);
+      if constexpr (kCos) StoreN(cos_v, d, cos_out + i, remaining);
+    }
+  }
+}
+
+template <Operation OP, typename Prec, typename T>
+NPSR_INTRIN void PlanTanArray(const ReductionPlan<T> &plan,
+                              T *HWY_RESTRICT out) {
+  using namespace hn;
+  const ScalableTag<T> d;
+  const RebindToSigned<decltype(d)> di;
+  const Rebind<uint8_t, decltype(d)> d8;
+  using V = Vec<decltype(d)>;
+  const size_t N = Lanes(d);
+  const size_t count = plan.Count();
+  for (size_t i = 0; i < count; i += N) {
+    const V r_hi = Load(d, plan.RHi() + i);
+    V ret = TanReduced<OP, true>(
+        PromoteTo(di, LoadU(d8, plan.Quadrant() + i)), r_hi,
+        Load(d, plan.RLo() + i));
+    if constexpr (Prec::kSpecialCases) {
+      // -0.0 should return -0.0 for tangent, cot(±0) = ±∞
+      const auto is_zero = Eq(r_hi, Zero(d));
+      ret = IfThenElse(is_zero,
+                       OP == Operation::kTan ? r_hi : CopySign(Inf(d), r_hi),
+                       ret);
+    }
+    const size_t remaining = count - i;
+    if (HWY_LIKELY(remaining >= N)) {
+      StoreU(ret, d, out + i);
+    } else {
+      StoreN(ret, d, out + i, remaining);
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace trig
+
+/**
+ * @brief Compute sine of every planned angle
+ *
+ * @param prec   Precise object, kSpecialCases keeps sin(-0) = -0
+ * @param plan   Reduced angles
+ * @param out    Output array of plan.Count() elements
+ */
+template <typename Prec, typename T>
+NPSR_INTRIN void Sin(Prec &prec, const ReductionPlan<T> &plan,
+                     T *HWY_RESTRICT out) {
+  (void)prec;
+  trig::PlanArray<true, false, Prec>(plan, out, static_cast<T *>(nullptr));
+}
+
+/// Compute cosine of every planned angle, see the plan overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Cos(Prec &prec, const ReductionPlan<T> &plan,
+                     T *HWY_RESTRICT out) {
+  (void)prec;
+  trig::PlanArray<false, true, Prec>(plan, static_cast<T *>(nullptr), out);
+}
+
+/// Compute sine and cosine of every planned angle in one pass.
+template <typename Prec, typename T>
+NPSR_INTRIN void SinCos(Prec &prec, const ReductionPlan<T> &plan,
+                        T *HWY_RESTRICT sin_out, T *HWY_RESTRICT cos_out) {
+  (void)prec;
+  trig::PlanArray<true, true, Prec>(plan, sin_out, cos_out);
+}
+
+/// Compute tangent of every planned angle, see the plan overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Tan(Prec &prec, const ReductionPlan<T> &plan,
+                     T *HWY_RESTRICT out) {
+  (void)prec;
+  trig::PlanTanArray<trig::Operation::kTan, Prec>(plan, out);
+}
+
+/// Compute cotangent of every planned angle, see the plan overload of Sin.
+template <typename Prec, typename T>
+NPSR_INTRIN void Cot(Prec &prec, const ReductionPlan<T> &plan,
+                     T *HWY_RESTRICT out) {
+  (void)prec;
+  trig::PlanTanArray<trig::Operation::kCot, Prec>(plan, out);
+}
+
+}  // namespace npsr::HWY_NAMESPACE
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_PLAN_INL_H_
@@ -0,0 +1,298 @@
+#if defined(NPSR_TRIG_REDUCE_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_REDUCE_INL_H_
+#undef NPSR_TRIG_REDUCE_INL_H_
+#else
+#define NPSR_TRIG_REDUCE_INL_H_
+#endif
+
+#include <iterator>
+
+#include "npsr/hwy.h"
+#include "npsr/precise.h"
+#include "npsr/trig/data/data.h"
+#include "npsr/trig/extended-inl.h"  // ExtendedReduce
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+/**
+ * Cody-Waite reduction x = n·π/2 + r for the standard range, using the π
+ * pieces of Low<> (data::kPi halved, which is exact).
+ *
+ * With kCompensated, the rounding error of every subtraction is collected
+ * into r_lo and the pair is renormalized, so r_hi is within 0.5 ULP of the
+ * exact remainder and r_lo holds the next bits. Otherwise r_lo is zero and
+ * r_hi matches Low<>.
+ */
+template <bool kCompensated, typename V, typename VI>
+NPSR_INTRIN void CodyWaitePiDiv2(V x, VI &quadrant, V &r_hi, V &r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  // n = round(x·2/π), the low bits of the biased value hold n mod 4
+  const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
+  V n_biased = MulAdd(x, Set(d, data::kInvPi<T> * 2), magic_round);
+  V n = Sub(n_biased, magic_round);
+  quadrant = And(BitCast(di, n_biased), Set(di, 3));
+
+  // Collecting the rounding errors requires exact products n·πᵢ, which only
+  // the short pieces used on non-FMA targets guarantee (|n| < 2^13 for
+  // float, 2^29 for double, both beyond the standard range)
+  constexpr const auto &kPi = data::kPi<T, kNativeFMA && !kCompensated>;
+  constexpr size_t kParts = std::size(kPi);
+  // The leading piece is exact by construction, n·π₀ cancels x exactly
+  V r = NegMulAdd(n, Set(d, kPi[0] / 2), x);
+  V lo = Zero(d);
+  for (size_t i = 1; i + 1 < kParts; ++i) {
+    const V pi_part = Set(d, kPi[i] / 2);
+    V t = NegMulAdd(n, pi_part, r);
+    if constexpr (kCompensated) {
+      lo = Add(lo, NegMulAdd(n, pi_part, Sub(r, t)));
+    }
+    r = t;
+  }
+  lo = NegMulAdd(n, Set(d, kPi[kParts - 1] / 2), lo);
+  r_hi = Add(r, lo);
+  if constexpr (kCompensated) {
+    r_lo = Sub(lo, Sub(r_hi, r));
+  } else {
+    r_lo = Zero(d);
+  }
+}
+
+/**
+ * Converts the output of ExtendedReduce, x = k·(2π/2^kBits) + r, into
+ * quadrant form: k = 2^(kBits-2)·q + m with |m| ≤ 2^(kBits-3), so
+ * x = q·π/2 + (m·2π/2^kBits + r).
+ *
+ * The step is split into the short π pieces of data::kPi<T, false>, whose
+ * products with m are exact. For m ≠ 0 the step dominates r, so a fast
+ * two-sum is exact and there is no cancellation to worry about.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN void ExtendedPiDiv2(V x, VI &quadrant, V &r_hi, V &r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  using VU = Vec<RebindToUnsigned<DFromV<V>>>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr int kBits = std::is_same_v<T, float> ? 8 : 9;
+
+  VU quotient;
+  V r, r_lo_ext;
+  ExtendedReduce(x, quotient, r, r_lo_ext);
+
+  const VI half_quadrant = Set(di, 1 << (kBits - 3));
+  VI k = Add(BitCast(di, quotient), half_quadrant);
+  quadrant = And(ShiftRight<kBits - 2>(k), Set(di, 3));
+  VI m = Sub(And(k, Set(di, (1 << (kBits - 2)) - 1)), half_quadrant);
+  V mf = ConvertTo(d, m);
+
+  constexpr auto kPiShort = data::kPi<T, false>;
+  constexpr T kStep = static_cast<T>(1) / (1 << (kBits - 1));
+  V step_hi = Mul(mf, Set(d, kPiShort[0] * kStep));
+  V hi = Add(step_hi, r);
+  V lo = Sub(r, Sub(hi, step_hi));
+  lo = Add(lo, r_lo_ext);
+  lo = MulAdd(mf, Set(d, kPiShort[1] * kStep), lo);
+  lo = MulAdd(mf, Set(d, kPiShort[2] * kStep), lo);
+  lo = MulAdd(mf, Set(d, kPiShort[3] * kStep), lo);
+  r_hi = Add(hi, lo);
+  r_lo = Sub(lo, Sub(r_hi, hi));
+}
+
+// r -= n·π_part, the product being exact, its rounding error added to lo
+template <typename V>
+NPSR_INTRIN void LongCodyWaiteStep(V n, V pi_part, V &r, V &lo) {
+  using namespace hn;
+  V t = NegMulAdd(n, pi_part, r);
+  lo = Add(lo, NegMulAdd(n, pi_part, Sub(r, t)));
+  r = t;
+}
+
+/**
+ * Cody-Waite reduction x = n·π/2 + r past the standard range, for
+ * LargeArgument::kNeverExtended: no table lookup, a fixed sequence of
+ * arithmetic instead of ExtendedReduce.
+ *
+ * The quotient is split as n = n_hi + n_lo, n_hi a multiple of 2^24 and
+ * |n_lo| ≤ 2^23, so that both products with each 24-bit piece of
+ * data::kPi<double, false> are exact. The subtractions run from the largest
+ * term down, and their rounding errors are collected into r_lo as in
+ * CodyWaitePiDiv2<true>.
+ *
+ * Valid for |x| < 2^46 (~7·10^13), where n_hi fits the 29 bits the exact
+ * products allow and the estimate of n is off by at most 2^-7, so |r_hi|
+ * may exceed π/4 by π/2^8. The absolute error of r is below 2^-78, so only
+ * lanes within about 2^-26 of a multiple of π/2, rare past the standard
+ * range, lose relative accuracy. Beyond 2^46 the result is unspecified.
+ *
+ * Float widens to double, which keeps its full precision within the same
+ * range, and splits r back into a float pair.
+ */
+template <typename V, typename VI, HWY_IF_F64(hn::TFromV<V>)>
+NPSR_INTRIN void LongCodyWaitePiDiv2(V x, VI &quadrant, V &r_hi, V &r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+
+  const V two_div_pi = Set(d, data::kInvPi<double> * 2);
+  V n_hi = Mul(Round(Mul(Mul(x, two_div_pi), Set(d, 0x1p-24))),
+               Set(d, 0x1p24));
+  V n_lo = Round(MulSub(x, two_div_pi, n_hi));
+  // n_hi is a multiple of 4, the quadrant is that of n_lo
+  quadrant = And(ConvertTo(di, n_lo), Set(di, 3));
+
+  constexpr auto kPiShort = data::kPi<double, false>;
+  V r = x;
+  V lo = Zero(d);
+  for (size_t i = 0; i < 3; ++i) {
+    const V pi_part = Set(d, kPiShort[i] / 2);
+    LongCodyWaiteStep(n_hi, pi_part, r, lo);
+    LongCodyWaiteStep(n_lo, pi_part, r, lo);
+  }
+  lo = NegMulAdd(Add(n_hi, n_lo), Set(d, kPiShort[3] / 2), lo);
+  r_hi = Add(r, lo);
+  r_lo = Sub(lo, Sub(r_hi, r));
+}
+
+template <typename V, typename VI, HWY_IF_F32(hn::TFromV<V>)>
+NPSR_INTRIN void LongCodyWaitePiDiv2(V x, VI &quadrant, V &r_hi, V &r_lo) {
+  using namespace hn;
+  const DFromV<V> d;
+  const Half<decltype(d)> dh;
+  const Rebind<int32_t, decltype(dh)> dhi;
+  const RepartitionToWide<decltype(d)> dw;
+  const RebindToSigned<decltype(d)> di;
+  using VW = Vec<decltype(dw)>;
+  Vec<RebindToSigned<decltype(dw)>> q_lower, q_upper;
+  VW hi_lower, lo_lower, hi_upper, lo_upper;
+  LongCodyWaitePiDiv2(PromoteLowerTo(dw, x), q_lower, hi_lower, lo_lower);
+  LongCodyWaitePiDiv2(PromoteUpperTo(dw, x), q_upper, hi_upper, lo_upper);
+
+  auto lower = DemoteTo(dh, hi_lower);
+  auto upper = DemoteTo(dh, hi_upper);
+  r_hi = Combine(d, upper, lower);
+  r_lo = Combine(
+      d, DemoteTo(dh, Add(Sub(hi_upper, PromoteTo(dw, upper)), lo_upper)),
+      DemoteTo(dh, Add(Sub(hi_lower, PromoteTo(dw, lower)), lo_lower)));
+  quadrant = Combine(di, DemoteTo(dhi, q_upper), DemoteTo(dhi, q_lower));
+}
+
+/**
+ * @brief Vectorized rem_pio2: x = n·π/2 + r, r = r_hi + r_lo
+ *
+ * Follows the tiers of Trig:
+ * - kLowAccuracy: Cody-Waite with the pieces of Low<>, r_lo is zero
+ * - Otherwise: compensated Cody-Waite, r_hi within 0.5 ULP, r_lo extends it
+ * - kLargeArgument and |x| beyond the Trig thresholds: Payne-Hanek through
+ *   ExtendedReduce, the same tables as Extended<>, honoring the
+ *   LargeArgument branch policy. Under LargeArgument::kNeverExtended,
+ *   LongCodyWaitePiDiv2 always instead, valid for |x| < 2^46
+ *
+ * @param quadrant  n mod 4, in [0, 3]
+ * @param r_hi      Leading part of the remainder, |r_hi| ≲ π/4; lanes from
+ *                  the Payne-Hanek tier may exceed it by π/2^8 (float) or
+ *                  π/2^9 (double), and those of LongCodyWaitePiDiv2 by
+ *                  π/2^8, with the neighbouring quadrant
+ * @param r_lo      Trailing part of the remainder
+ *
+ * With kSpecialCases, non-finite lanes give r_hi = NaN, r_lo = 0 and
+ * quadrant 0, and -0.0 is preserved; infinities raise invalid unless
+ * kNoExceptions.
+ */
+template <typename Prec, typename V, typename VI>
+NPSR_INTRIN void ReducePiDiv2(Prec &prec, V x, VI &quadrant, V &r_hi,
+                              V &r_lo) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  CodyWaitePiDiv2<Prec::kHighAccuracy>(x, quadrant, r_hi, r_lo);
+
+  if constexpr (Prec::kLargeArgument) {
+    auto has_large_arg = And(
+        Gt(Abs(x), Set(d, kIsSingle ? 10000.0f : 16777216.0)), IsFinite(x));
+    if (!Prec::kBranchy || HWY_UNLIKELY(!AllFalse(d, has_large_arg))) {
+      VI ext_quadrant;
+      V ext_hi, ext_lo;
+      if constexpr (Prec::kNeverExtended) {
+        LongCodyWaitePiDiv2(x, ext_quadrant, ext_hi, ext_lo);
+      } else {
+        ExtendedPiDiv2(x, ext_quadrant, ext_hi, ext_lo);
+      }
+      quadrant =
+          IfThenElse(RebindMask(di, has_large_arg), ext_quadrant, quadrant);
+      r_hi = IfThenElse(has_large_arg, ext_hi, r_hi);
+      r_lo = IfThenElse(has_large_arg, ext_lo, r_lo);
+    }
+  }
+  if constexpr (Prec::kSpecialCases) {
+    auto is_finite = IsFinite(x);
+    r_hi = IfThenElse(is_finite, r_hi, NaN(d));
+    r_lo = IfThenElse(is_finite, r_lo, Zero(d));
+    quadrant = IfThenElseZero(RebindMask(di, is_finite), quadrant);
+    // -0.0 should return -0.0
+    r_hi = IfThenElse(Eq(x, Zero(d)), x, r_hi);
+  }
+  if constexpr (Prec::kExceptions) {
+    prec.Raise(!AllFalse(d, IsInf(x)) ? FPExceptions::kInvalid : 0);
+  }
+}
+
+/**
+ * @brief Wraps x into [-π, π], i.e. x - 2π·round(x/2π)
+ *
+ * Built on ReducePiDiv2: the quadrant is folded into {-2, ..., 2} and
+ * q·π/2 is added back with exact products of the short π pieces, so the
+ * wrapped angle is correctly rounded up to the error of ReducePiDiv2.
+ */
+template <typename Prec, typename V>
+NPSR_INTRIN V WrapAngle(Prec &prec, V x) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  using VI = Vec<decltype(di)>;
+
+  VI quadrant;
+  V r_hi, r_lo;
+  ReducePiDiv2(prec, x, quadrant, r_hi, r_lo);
+
+  // q ∈ {-1, 0, 1, 2}, then q = 2 with r > 0 lies beyond π so use -2
+  VI q = Sub(And(Add(quadrant, Set(di, 1)), Set(di, 3)), Set(di, 1));
+  auto beyond_pi = And(RebindMask(di, Gt(r_hi, Zero(d))), Eq(q, Set(di, 2)));
+  q = IfThenElse(beyond_pi, Set(di, -2), q);
+  V qf = ConvertTo(d, q);
+
+  constexpr auto kPiShort = data::kPi<T, false>;
+  V step_hi = Mul(qf, Set(d, kPiShort[0] / 2));
+  V hi = Add(step_hi, r_hi);
+  V lo = Sub(r_hi, Sub(hi, step_hi));
+  lo = Add(lo, r_lo);
+  lo = MulAdd(qf, Set(d, kPiShort[1] / 2), lo);
+  lo = MulAdd(qf, Set(d, kPiShort[2] / 2), lo);
+  lo = MulAdd(qf, Set(d, kPiShort[3] / 2), lo);
+  V ret = Add(hi, lo);
+  if constexpr (Prec::kSpecialCases) {
+    ret = IfThenElse(Eq(x, Zero(d)), x, ret);
+  }
+  return ret;
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_REDUCE_INL_H_
@@ -0,0 +1,100 @@
+#if defined(NPSR_TRIG_SMALL_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_SMALL_INL_H_
+#undef NPSR_TRIG_SMALL_INL_H_
+#else
+#define NPSR_TRIG_SMALL_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/poly-inl.h"
+#include "npsr/trig/data/data.h"
+#include "npsr/trig/low-inl.h"  // Operation
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+// Lanes inside the domain of Small<>, |x| ≤ π/4. NaN lanes compare false.
+template <typename V>
+NPSR_INTRIN auto SmallArgMask(V x) {
+  using namespace hn;
+  using T = TFromV<V>;
+  namespace data = ::npsr::trig::data;
+  const DFromV<V> d;
+  return Le(Abs(x), Set(d, data::kHalfPi<T> / 2));
+}
+
+/**
+ * sin(r + r_lo) for |r| ≲ π/4, r_lo being a tail below ulp(r) as produced
+ * by ReducePiDiv2. sin(r + r_lo) ≈ sin(r) + r_lo, the r_lo·r²/2 term is
+ * below the rounding error.
+ */
+template <typename V>
+NPSR_INTRIN V SmallSin(V r, V r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const V r2 = Mul(r, r);
+  V poly = Poly(r2, data::kSinSmall<T>);
+  return Add(r, MulAdd(Mul(r2, r), poly, r_lo));
+}
+
+/**
+ * cos(r + r_lo) for |r| ≲ π/4, see SmallSin. cos(r + r_lo) ≈ cos(r) - r·r_lo.
+ *
+ * cos(r) ≈ 1 - r²/2 + r⁴·Q(r²). Since r²/2 ≤ 0.31, w = 1 - r²/2 is computed
+ * with its exact rounding error (1 - w) - r²/2, and the rounding error of r²
+ * itself is recovered by FMA when the target fuses it.
+ */
+template <typename V>
+NPSR_INTRIN V SmallCos(V r, V r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const V one = Set(d, static_cast<T>(1.0));
+  const V half = Set(d, static_cast<T>(0.5));
+  const V r2 = Mul(r, r);
+  V hr2 = Mul(r2, half);
+  V w = Sub(one, hr2);
+  V corr = Sub(Sub(one, w), hr2);
+  if constexpr (kNativeFMA) {
+    // exact low part of r²/2
+    corr = NegMulAdd(MulSub(r, r, r2), half, corr);
+  }
+  corr = NegMulAdd(r, r_lo, corr);
+  V poly = Poly(r2, data::kCosSmall<T>);
+  corr = MulAdd(Mul(r2, r2), poly, corr);
+  return Add(w, corr);
+}
+
+/**
+ * This function computes sin(x) or cos(x) for |x| ≤ π/4 without any range
+ * reduction, table lookup or sign fix-up, < 1 ULP error for both types.
+ *
+ * - sin(x) ≈ x + x³·P(x²), x added last so it is rounded once.
+ * - cos(x) ≈ 1 - x²/2 + x⁴·Q(x²), see SmallCos.
+ *
+ * Polynomials are generated by npsr/trig/data/small.h.sol.
+ */
+template <Operation OP, typename V>
+NPSR_INTRIN V Small(V x) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+
+  if constexpr (OP == Operation::kSin) {
+    const V x2 = Mul(x, x);
+    V poly = Poly(x2, data::kSinSmall<T>);
+    return MulAdd(Mul(x2, x), poly, x);
+  } else {
+    return SmallCos(x, Zero(DFromV<V>()));
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_SMALL_INL_H_
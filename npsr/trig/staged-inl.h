@@ -0,0 +1,112 @@
+#if defined(NPSR_TRIG_STAGED_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_STAGED_INL_H_
+#undef NPSR_TRIG_STAGED_INL_H_
+#else
+#define NPSR_TRIG_STAGED_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/poly-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+/**
+ * @brief Runs a trig kernel split into stages, over one, two or four vectors.
+ *
+ * The standard range kernels, Low<>, High<>, TanLow<> and TanHigh<>, are
+ * written as three stages so that several vectors can be interleaved
+ * explicitly: every reduction first, then the polynomials in lockstep, see
+ * PolyLockstep<>, then every reconstruction. Left to the compiler, kernels
+ * inlined back to back under HWY_FLATTEN tend to stay one long chain each.
+ *
+ * A kernel K is a struct of static members only, so it holds no vector:
+ * - PolyTag<D>: tag of the polynomial variables, D or a wider one
+ * - kChains: polynomials per vector, 1 or 2
+ * - Coeffs0(), Coeffs1(): their coefficients, Coeffs1() read for 2 chains
+ * - Reduce(x, s, r0, r1, a0, a1): range reduction of x into the integer
+ *   part s, the remainder r0 + r1 or its pieces, and the polynomial
+ *   variables a0 and a1, a1 = a0 for a single chain
+ * - Finish(x, s, r0, r1, a0, a1, p0, p1): reconstruction from the
+ *   polynomial values p0 = P0(a0) and p1 = P1(a1)
+ *
+ * A single vector takes Poly<> with its per-target default scheme, since it
+ * has no other chain to hide the latency behind.
+ */
+template <class K, typename V>
+NPSR_INTRIN V Staged(V x) {
+  using namespace hn;
+  using P = Vec<typename K::template PolyTag<DFromV<V>>>;
+  V s;
+  P r0, r1, a0, a1;
+  K::Reduce(x, s, r0, r1, a0, a1);
+  P p0 = Poly(a0, K::Coeffs0());
+  P p1 = a1;
+  if constexpr (K::kChains == 2) {
+    p1 = Poly(a1, K::Coeffs1());
+  }
+  return K::Finish(x, s, r0, r1, a0, a1, p0, p1);
+}
+
+/// Two-vector variant of Staged, two or four chains in lockstep.
+template <class K, typename V>
+NPSR_INTRIN void Staged(V x0, V x1, V &y0, V &y1) {
+  using namespace hn;
+  using P = Vec<typename K::template PolyTag<DFromV<V>>>;
+  V s0, s1;
+  P r00, r01, a00, a01;
+  P r10, r11, a10, a11;
+  K::Reduce(x0, s0, r00, r01, a00, a01);
+  K::Reduce(x1, s1, r10, r11, a10, a11);
+
+  P p00, p10, p01 = a01, p11 = a11;
+  if constexpr (K::kChains == 2) {
+    PolyLockstep<P, P>::Eval(K::Coeffs0(), a00, a10, p00, p10, K::Coeffs1(),
+                             a01, a11, p01, p11);
+  } else {
+    PolyLockstep<P, P>::Eval(K::Coeffs0(), a00, a10, p00, p10);
+  }
+
+  y0 = K::Finish(x0, s0, r00, r01, a00, a01, p00, p01);
+  y1 = K::Finish(x1, s1, r10, r11, a10, a11, p10, p11);
+}
+
+/// Four-vector variant of Staged, four or eight chains in lockstep.
+template <class K, typename V>
+NPSR_INTRIN void Staged(V x0, V x1, V x2, V x3, V &y0, V &y1, V &y2, V &y3) {
+  using namespace hn;
+  using P = Vec<typename K::template PolyTag<DFromV<V>>>;
+  V s0, s1, s2, s3;
+  P r00, r01, a00, a01;
+  P r10, r11, a10, a11;
+  P r20, r21, a20, a21;
+  P r30, r31, a30, a31;
+  K::Reduce(x0, s0, r00, r01, a00, a01);
+  K::Reduce(x1, s1, r10, r11, a10, a11);
+  K::Reduce(x2, s2, r20, r21, a20, a21);
+  K::Reduce(x3, s3, r30, r31, a30, a31);
+
+  P p00, p10, p20, p30;
+  P p01 = a01, p11 = a11, p21 = a21, p31 = a31;
+  if constexpr (K::kChains == 2) {
+    PolyLockstep<P, P, P, P>::Eval(K::Coeffs0(), a00, a10, a20, a30, p00, p10,
+                                   p20, p30, K::Coeffs1(), a01, a11, a21, a31,
+                                   p01, p11, p21, p31);
+  } else {
+    PolyLockstep<P, P, P, P>::Eval(K::Coeffs0(), a00, a10, a20, a30, p00, p10,
+                                   p20, p30);
+  }
+
+  y0 = K::Finish(x0, s0, r00, r01, a00, a01, p00, p01);
+  y1 = K::Finish(x1, s1, r10, r11, a10, a11, p10, p11);
+  y2 = K::Finish(x2, s2, r20, r21, a20, a21, p20, p21);
+  y3 = K::Finish(x3, s3, r30, r31, a30, a31, p30, p31);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_STAGED_INL_H_
@@ -0,0 +1,240 @@
+#if defined(NPSR_TRIG_TAN_INL_H_) == defined(HWY_TARGET_TOGGLE)  // NOLINT
+#ifdef NPSR_TRIG_TAN_INL_H_
+#undef NPSR_TRIG_TAN_INL_H_
+#else
+#define NPSR_TRIG_TAN_INL_H_
+#endif
+
+#include "npsr/hwy.h"
+#include "npsr/lut-inl.h"
+#include "npsr/poly-inl.h"
+#include "npsr/trig/data/data.h"
+#include "npsr/trig/low-inl.h"     // Operation
+#include "npsr/trig/reduce-inl.h"  // CodyWaitePiDiv2, ExtendedPiDiv2
+#include "npsr/trig/staged-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+
+namespace npsr::HWY_NAMESPACE::trig {
+
+/**
+ * Step 1 of TanReduced<>: s_hi + s_lo = r - j·π/16 and s2 = s_hi², the
+ * variable of the polynomial; k = 8·q + j + 4 indexes the table.
+ */
+template <typename V, typename VI>
+NPSR_INTRIN void TanSplit(VI quadrant, V r_hi, V r_lo, VI &k, V &s_hi,
+                          V &s_lo, V &s2) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+
+  // Step 1: j = round(r·16/π), s = r - j·π/16
+  const V magic_round = Set(d, kIsSingle ? 0x1.8p23f : 0x1.8p52);
+  V j_biased = MulAdd(r_hi, Set(d, data::k16DivPi<T>), magic_round);
+  V j = Sub(j_biased, magic_round);
+
+  constexpr auto kPiShort = data::kPi<T, false>;
+  constexpr T kStep = static_cast<T>(1.0 / 16);
+  // r_hi lies within a factor of two of j·π/16 whenever j ≠ 0, so the
+  // leading step is exact
+  V s = NegMulAdd(j, Set(d, kPiShort[0] * kStep), r_hi);
+  V lo = NegMulAdd(j, Set(d, kPiShort[1] * kStep), r_lo);
+  lo = NegMulAdd(j, Set(d, kPiShort[2] * kStep), lo);
+  lo = NegMulAdd(j, Set(d, kPiShort[3] * kStep), lo);
+  s_hi = Add(s, lo);
+  s_lo = Sub(lo, Sub(s_hi, s));
+  s2 = Mul(s_hi, s_hi);
+  k = Add(Add(ShiftLeft<3>(quadrant), BitCast(di, j_biased)), Set(di, 4));
+}
+
+/**
+ * Steps 2 to 4 of TanReduced<> from the output of TanSplit<> and
+ * poly = P(s2).
+ */
+template <Operation OP, bool kCompensated, typename V, typename VI>
+NPSR_INTRIN V TanFinish(VI k, V s_hi, V s_lo, V s2, V poly) {
+  using namespace hn;
+  using T = TFromV<V>;
+  const DFromV<V> d;
+  const RebindToSigned<decltype(d)> di;
+  const RebindToUnsigned<decltype(d)> du;
+  constexpr bool kIsSingle = std::is_same_v<T, float>;
+  const V one = Set(d, static_cast<T>(1.0));
+
+  // Step 2: Load tan(j·π/16) for the combined index 8·q + j
+  V tan_hi, tan_lo;
+  const auto table_idx = BitCast(du, And(k, Set(di, 7)));
+  if constexpr (kIsSingle) {
+    kTanKPi16TableF32.Load(table_idx, tan_hi, tan_lo);
+  } else {
+    kTanKPi16TableF64.Load(table_idx, tan_hi, tan_lo);
+  }
+
+  // Step 3: tan(s) ≈ s + s³·P(s²), the s_lo·s² term is below the rounding
+  V u_lo = MulAdd(Mul(s2, s_hi), poly, s_lo);
+
+  // Step 4: N = tan(a) + tan(s), D = 1 - tan(a)·tan(s)
+  V num_hi, num_lo, den_hi, den_lo;
+  if constexpr (kCompensated) {
+    // tan(s) = t_hi + t_lo, |u_lo| < |s_hi| so the fast two-sum is exact
+    V t_hi = Add(s_hi, u_lo);
+    V t_lo = Sub(u_lo, Sub(t_hi, s_hi));
+    // |tan(a)| ≥ tan(π/16) > |tan(s)| unless tan(a) is zero, exact as well
+    num_hi = Add(tan_hi, t_hi);
+    num_lo = Add(Sub(t_hi, Sub(num_hi, tan_hi)), Add(tan_lo, t_lo));
+    // D lies within [0.9, 1.1], 1 - D is exact and the FMA recovers the
+    // rounding error of the product
+    den_hi = NegMulAdd(tan_hi, t_hi, one);
+    den_lo = NegMulAdd(tan_hi, t_hi, Sub(one, den_hi));
+    den_lo = NegMulAdd(tan_hi, t_lo, den_lo);
+    den_lo = NegMulAdd(tan_lo, t_hi, den_lo);
+  } else {
+    V tan_s = Add(s_hi, u_lo);
+    num_hi = Add(tan_hi, tan_s);
+    den_hi = NegMulAdd(tan_hi, tan_s, one);
+  }
+
+  // Odd quadrants of tan and even quadrants of cot take D/N
+  const VI odd_bit = And(k, Set(di, 8));
+  auto swap = Eq(odd_bit, Zero(di));
+  if constexpr (OP == Operation::kTan) {
+    swap = Not(swap);
+  }
+  const auto swap_mask = RebindMask(d, swap);
+  V ret;
+  if constexpr (kCompensated) {
+    V a_hi = IfThenElse(swap_mask, den_hi, num_hi);
+    V a_lo = IfThenElse(swap_mask, den_lo, num_lo);
+    V b_hi = IfThenElse(swap_mask, num_hi, den_hi);
+    V b_lo = IfThenElse(swap_mask, num_lo, den_lo);
+    // q = a/b refined by the remainder (a - q·b)/b, one division
+    V recip = Div(one, b_hi);
+    V q = Mul(a_hi, recip);
+    V rem = NegMulAdd(q, b_hi, a_hi);
+    rem = Add(rem, a_lo);
+    rem = NegMulAdd(q, b_lo, rem);
+    ret = MulAdd(rem, recip, q);
+  } else {
+    ret = Div(IfThenElse(swap_mask, den_hi, num_hi),
+              IfThenElse(swap_mask, num_hi, den_hi));
+  }
+  // tan(x + π/2) = -cot(x) and cot(x + π/2) = -tan(x)
+  VI sign = ShiftLeft<sizeof(T) * 8 - 4>(odd_bit);
+  return Xor(ret, BitCast(d, sign));
+}
+
+/**
+ * This function computes tan(x) or cot(x) from x = q·π/2 + r_hi + r_lo, the
+ * output of the π/2 reduction tiers.
+ *
+ * Algorithm Overview:
+ * 1. Table Reduction: r = j·π/16 + s, where |s| ≤ π/32 and -4 ≤ j ≤ 4
+ *    - The π/16 step is taken in the short pieces of data::kPi<T, false>,
+ *      whose products with j are exact
+ *
+ * 2. Table Lookup: Retrieves tan(j·π/16) as high and low parts, indexed by
+ *    (8·q + j + 4) mod 8, so j = 4 folds into j = -4 of the next quadrant
+ *    and every entry lies within [-1, 1]
+ *
+ * 3. Polynomial Approximation: tan(s) ≈ s + s³·P(s²), a minimax polynomial
+ *    generated by npsr/trig/data/tan.h.sol
+ *
+ * 4. Reconstruction: tan(a + s) = (tan(a) + tan(s)) / (1 - tan(a)·tan(s))
+ *    as N/D, and tan(x + π/2) = -1/tan(x) gives -D/N for odd quadrants;
+ *    cotangent swaps the two cases. A single division either way.
+ *
+ * With kCompensated, N and D are carried as double-word pairs and the
+ * quotient is refined by one correction step, ~0.53 ULP error with native
+ * FMA and < 2 ULP without, where the residuals are no longer exact.
+ * Otherwise N and D are rounded once each, ~3-4 ULP error.
+ */
+template <Operation OP, bool kCompensated, typename V, typename VI>
+NPSR_INTRIN V TanReduced(VI quadrant, V r_hi, V r_lo) {
+  using namespace hn;
+  namespace data = ::npsr::trig::data;
+  VI k;
+  V s_hi, s_lo, s2;
+  TanSplit(quadrant, r_hi, r_lo, k, s_hi, s_lo, s2);
+  V poly = Poly(s2, data::kTanPoly<TFromV<V>>);
+  return TanFinish<OP, kCompensated>(k, s_hi, s_lo, s2, poly);
+}
+
+/**
+ * Stages of TanLow<> and TanHigh<>, see Staged<>: Cody-Waite reduction by
+ * π/2 then TanSplit<>, s holding k and r0 + r1 = s_hi + s_lo, a0 = s_hi².
+ */
+template <Operation OP, bool kCompensated, typename T>
+struct TanStages {
+  static constexpr size_t kChains = 1;
+  template <class D>
+  using PolyTag = D;
+
+  static constexpr const auto &Coeffs0() {
+    return ::npsr::trig::data::kTanPoly<T>;
+  }
+  static constexpr const auto &Coeffs1() { return Coeffs0(); }
+
+  template <typename V>
+  NPSR_INTRIN void Reduce(V x, V &k, V &s_hi, V &s_lo, V &s2, V &a1) {
+    using namespace hn;
+    const DFromV<V> d;
+    Vec<RebindToSigned<decltype(d)>> quadrant, k_int;
+    V r_hi, r_lo;
+    CodyWaitePiDiv2<kCompensated>(x, quadrant, r_hi, r_lo);
+    TanSplit(quadrant, r_hi, r_lo, k_int, s_hi, s_lo, s2);
+    k = BitCast(d, k_int);
+    a1 = s2;
+  }
+
+  template <typename V>
+  NPSR_INTRIN V Finish(V, V k, V s_hi, V s_lo, V s2, V, V poly, V) {
+    using namespace hn;
+    const RebindToSigned<DFromV<V>> di;
+    return TanFinish<OP, kCompensated>(BitCast(di, k), s_hi, s_lo, s2, poly);
+  }
+};
+
+/// Low precision tier: Cody-Waite reduction as in Low<>, ~3-4 ULP error.
+template <Operation OP, typename V>
+NPSR_INTRIN V TanLow(V x) {
+  return Staged<TanStages<OP, false, hn::TFromV<V>>>(x);
+}
+
+/**
+ * High precision tier: compensated Cody-Waite reduction, accurate for
+ * |x| < 10^4 (float) or |x| < 2^24 (double), beyond which TanExtended<>
+ * takes over.
+ */
+template <Operation OP, typename V>
+NPSR_INTRIN V TanHigh(V x) {
+  return Staged<TanStages<OP, true, hn::TFromV<V>>>(x);
+}
+
+/// Large argument tier: Payne-Hanek reduction through ExtendedPiDiv2.
+template <Operation OP, typename V>
+NPSR_INTRIN V TanExtended(V x) {
+  using namespace hn;
+  Vec<RebindToSigned<DFromV<V>>> quadrant;
+  V r_hi, r_lo;
+  ExtendedPiDiv2(x, quadrant, r_hi, r_lo);
+  return TanReduced<OP, true>(quadrant, r_hi, r_lo);
+}
+
+/// Small argument tier for |x| ≤ π/4, skips the π/2 reduction, see Small<>.
+template <Operation OP, typename V>
+NPSR_INTRIN V TanSmall(V x) {
+  using namespace hn;
+  const DFromV<V> d;
+  return TanReduced<OP, true>(Zero(RebindToSigned<decltype(d)>()), x,
+                              Zero(d));
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace npsr::HWY_NAMESPACE::trig
+
+HWY_AFTER_NAMESPACE();
+
+#endif  // NPSR_TRIG_TAN_INL_H_
@@ -240,6 +240,28 @@ procedure Constants(pArgs = ...) {
   return r;
 };
 
+// Minimax polynomial generation
+// Fits pFunc ≈ pFixed + Σ cᵢ·x^pMonos[i] on pRange with fpminimax, every
+// coefficient rounded to the precision of pT, minimizing the relative error.
+// Returns a structure with:
+//   .coeffs - the coefficients ordered from the highest monomial down,
+//             which is the order Horner evaluation consumes them in
+//   .error  - the dirty sup-norm of the relative error over pRange
+procedure MinimaxCoeffs(pT, pFunc, pMonos, pRange, pFixed) {
+  var r, i, $;
+  $.formats = [||];
+  for i in pMonos do {
+    $.formats = $.formats :. pT.kDigits;
+  };
+  $.poly = fpminimax(pFunc, pMonos, $.formats, pRange, relative, floating, pFixed);
+  r = [||];
+  for i in revert(pMonos) do {
+    r = r :. coeff($.poly, i);
+  };
+  $.error = dirtyinfnorm(($.poly - pFunc) / pFunc, pRange);
+  return { .coeffs = r, .error = $.error };
+};
+
 // Output accumulation procedures
 
 // Append lines to the output buffer
@@ -403,8 +425,9 @@ procedure WriteHighwayHeader(pNamespace = ...) {
   |];
   
   Prepend @ $.pre;
-  // to suppress the unused 'target' attribute warning from '#pragma clang attribute push'
-  Append @ [|"inline HWY_ATTR void _dummy_suppress_unused_target(){}"|]; 
+  // to suppress the unused 'target' attribute warning from '#pragma clang attribute push',
+  // named after the guard so headers sharing a namespace don't redefine it
+  Append @ [|"inline HWY_ATTR void _dummy_suppress_unused_target_" @ SOURCE_GUARD_NAME @ "(){}"|]; 
   Append @ $.post;
   Write();
 };